@@ -0,0 +1,131 @@
+#include "counting_allocator.hpp"
+
+#include <dsa/b_tree.hpp>
+#include <dsa/binary_tree.hpp>
+#include <dsa/dynamic_array.hpp>
+#include <dsa/red_black_tree.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <random>
+#include <string>
+
+namespace benchmark
+{
+
+namespace
+{
+
+using Key  = std::uint64_t;
+using Keys = dsa::Dynamic_Array<Key>;
+
+template<std::size_t Node_Bytes>
+using B_Tree = dsa::B_Tree<Key, Key, Node_Bytes, std::less<Key>, Counting_Allocator<Key>>;
+
+using Binary_Tree    = dsa::Binary_Tree<Key, Counting_Allocator<Key>>;
+using Red_Black_Tree = dsa::Red_Black_Tree<Key, Counting_Allocator<Key>>;
+
+/// @brief Inserts the keys into a tree using a Counting_Allocator, reports how
+/// many allocations that took, and times finding the lookups in the tree
+template<typename Tree>
+void benchmark_tree(
+    std::string const &name,
+    Keys const        &keys,
+    Keys const        &lookups,
+    auto const        &insert) {
+	std::string const suffix = " on " + name + " with " + std::to_string(keys.size()) + " keys";
+
+	Allocation_Counter counter;
+	Tree               tree{Counting_Allocator<Key>(counter)};
+	for (Key const key : keys)
+	{
+		insert(tree, key);
+	}
+	WARN("Allocations" << suffix << ": " << counter.allocations);
+
+	BENCHMARK("Find" + suffix) {
+		std::size_t found = 0;
+		for (Key const key : lookups)
+		{
+			found += static_cast<std::size_t>(tree.contains(key));
+		}
+		return found;
+	};
+}
+
+/// @brief Looks up random keys which are all present, the lookups visit the
+/// same keys in another order than they were inserted
+void compare_ordered_lookups(std::size_t count) {
+	std::mt19937_64 generator(count);
+	Keys            keys(count);
+	Keys            lookups(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		keys[i] = generator();
+	}
+	std::uniform_int_distribution<std::size_t> index(0, count - 1);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		lookups[i] = keys[index(generator)];
+	}
+
+	auto const insert_pair = [](auto &tree, Key key) {
+		tree.insert(key, key);
+	};
+	auto const insert_key = [](auto &tree, Key key) {
+		tree.insert(key);
+	};
+
+	benchmark_tree<B_Tree<256>>("B_Tree of 256 byte nodes", keys, lookups, insert_pair);
+	benchmark_tree<B_Tree<4096>>("B_Tree of 4096 byte nodes", keys, lookups, insert_pair);
+	benchmark_tree<Red_Black_Tree>("Red_Black_Tree", keys, lookups, insert_key);
+	benchmark_tree<Binary_Tree>("Binary_Tree", keys, lookups, insert_key);
+}
+
+} // namespace
+
+TEST_CASE("B tree against binary search trees", "[b_tree]") {
+	std::size_t const count = GENERATE(10'000ULL, 1'000'000ULL);
+	compare_ordered_lookups(count);
+}
+
+TEST_CASE("Range scans over a B tree", "[b_tree]") {
+	constexpr std::size_t count = 1'000'000;
+
+	B_Tree<256>        tree;
+	std::map<Key, Key> map;
+	for (Key key = 0; key < count; ++key)
+	{
+		tree.insert(key * 2, key);
+		map.emplace(key * 2, key);
+	}
+
+	// Sums the values of a thousand consecutive keys from a thousand starts
+	auto const scan = [](auto const &container) {
+		Key sum = 0;
+		for (Key start = 0; start < 2 * count; start += 2 * count / 1'000)
+		{
+			auto element = container.lower_bound(start);
+			for (std::size_t i = 0; i < 1'000 && element != container.end(); ++i)
+			{
+				sum += element->second;
+				++element;
+			}
+		}
+		return sum;
+	};
+
+	BENCHMARK("Range scans on B_Tree of 256 byte nodes") {
+		return scan(tree);
+	};
+
+	BENCHMARK("Range scans on std::map") {
+		return scan(map);
+	};
+}
+
+} // namespace benchmark
@@ -0,0 +1,119 @@
+#include <dsa/algorithms.hpp>
+#include <dsa/dynamic_array.hpp>
+#include <dsa/eytzinger_array.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <string>
+
+namespace benchmark
+{
+
+namespace
+{
+
+/// The binary search which the branchless search replaced, kept as a baseline.
+/// It branches on every comparison, which mispredicts half of the time on
+/// random queries
+template<typename Iterator>
+auto branching_binary_search(Iterator begin, Iterator end, int value) -> std::optional<Iterator> {
+	while (begin != end)
+	{
+		Iterator const       mid   = begin + (end - begin) / 2;
+		std::strong_ordering order = *mid <=> value;
+		if (std::is_eq(order))
+		{
+			return mid;
+		}
+
+		if (std::is_gt(order))
+		{
+			end = mid;
+		}
+		else
+		{
+			begin = mid + 1;
+		}
+	}
+	return {};
+}
+
+constexpr std::size_t query_count = 4'096;
+
+/// Every benchmark runs the same random queries over the even numbers in
+/// [0, 2 * count), so half of them are found
+void compare_binary_searches(std::size_t count) {
+	dsa::Dynamic_Array<int> sorted(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		sorted[i] = static_cast<int>(2 * i);
+	}
+	dsa::Eytzinger_Array<int> const eytzinger(sorted);
+	int const *const                first = sorted.begin();
+	int const *const                last  = sorted.end();
+
+	std::mt19937                       generator(count);
+	std::uniform_int_distribution<int> distribution(0, static_cast<int>(2 * count - 1));
+	dsa::Dynamic_Array<int>            queries(query_count);
+	std::generate(queries.begin(), queries.end(), [&] { return distribution(generator); });
+
+	std::string const suffix = " over " + std::to_string(count) + " keys";
+
+	BENCHMARK("Branching binary search" + suffix) {
+		std::size_t found = 0;
+		for (int const query : queries)
+		{
+			auto const element = branching_binary_search(first, last, query);
+			found += element.has_value();
+		}
+		return found;
+	};
+
+	BENCHMARK("Branchless binary search" + suffix) {
+		std::size_t found = 0;
+		for (int const query : queries)
+		{
+			auto const element = dsa::binary_search(first, last, query);
+			found += element.has_value();
+		}
+		return found;
+	};
+
+	BENCHMARK("std::binary_search" + suffix) {
+		std::size_t found = 0;
+		for (int const query : queries)
+		{
+			found += std::binary_search(first, last, query);
+		}
+		return found;
+	};
+
+	BENCHMARK("Eytzinger array search" + suffix) {
+		std::size_t found = 0;
+		for (int const query : queries)
+		{
+			found += eytzinger.contains(query);
+		}
+		return found;
+	};
+}
+
+} // namespace
+
+TEST_CASE("Binary search against the branching implementation", "[binary_search]") {
+	std::size_t const count = GENERATE(1'000ULL, 100'000ULL, 10'000'000ULL);
+	compare_binary_searches(count);
+}
+
+// Hidden by default as the tables take a few gigabytes to build, select it
+// with the [large] tag
+TEST_CASE("Binary search against the branching implementation on large tables", "[.][large]") {
+	compare_binary_searches(100'000'000);
+}
+
+} // namespace benchmark
@@ -0,0 +1,66 @@
+#include <dsa/binary_tree.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+
+namespace benchmark
+{
+
+namespace
+{
+
+using Key = std::uint64_t;
+
+/// @brief Sums every element of trees built from the same random keys, with
+/// the iterators and with the in order visitor
+void compare_full_scans(std::size_t count) {
+	std::mt19937_64       generator(count);
+	dsa::Binary_Tree<Key> tree;
+	std::set<Key>         set;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		Key const key = generator();
+		tree.insert(key);
+		set.insert(key);
+	}
+
+	std::string const suffix = " over " + std::to_string(count) + " keys";
+
+	BENCHMARK("Binary_Tree iterator scan" + suffix) {
+		Key sum = 0;
+		for (Key const key : tree)
+		{
+			sum += key;
+		}
+		return sum;
+	};
+
+	BENCHMARK("Binary_Tree for_each_in_order scan" + suffix) {
+		Key sum = 0;
+		tree.for_each_in_order([&sum](Key const key) { sum += key; });
+		return sum;
+	};
+
+	BENCHMARK("std::set iterator scan" + suffix) {
+		Key sum = 0;
+		for (Key const key : set)
+		{
+			sum += key;
+		}
+		return sum;
+	};
+}
+
+} // namespace
+
+TEST_CASE("Full scans over a binary tree", "[binary_tree]") {
+	std::size_t const count = GENERATE(10'000ULL, 1'000'000ULL);
+	compare_full_scans(count);
+}
+
+} // namespace benchmark
@@ -0,0 +1,78 @@
+#include <dsa/bounded_queue.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace benchmark
+{
+
+namespace
+{
+
+constexpr std::size_t element_count = 1'000'000;
+
+/// @brief Passes element_count values through the queue, split evenly over
+/// the producers, while as many consumers pop them
+std::size_t transfer(dsa::Bounded_Queue<std::size_t> &queue, std::size_t thread_count) {
+	std::size_t const        per_thread = element_count / thread_count;
+	std::size_t const        total      = per_thread * thread_count;
+	std::atomic<std::size_t> popped     = 0;
+	std::atomic<std::size_t> sum        = 0;
+
+	std::vector<std::thread> threads;
+	threads.reserve(2 * thread_count);
+	for (std::size_t thread = 0; thread < thread_count; ++thread)
+	{
+		threads.emplace_back([&queue, per_thread] {
+			for (std::size_t i = 0; i < per_thread; ++i)
+			{
+				while (!queue.try_push(std::size_t{i}))
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+		threads.emplace_back([&queue, &popped, &sum, total] {
+			std::size_t local_sum = 0;
+			while (popped.load(std::memory_order_relaxed) < total)
+			{
+				if (auto const value = queue.try_pop())
+				{
+					local_sum += *value;
+					popped.fetch_add(1, std::memory_order_relaxed);
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+			sum.fetch_add(local_sum, std::memory_order_relaxed);
+		});
+	}
+	for (std::thread &thread : threads)
+	{
+		thread.join();
+	}
+	return sum;
+}
+
+} // namespace
+
+TEST_CASE("Bounded queue throughput across producer and consumer threads", "[bounded_queue]") {
+	std::size_t const thread_count = GENERATE(1ULL, 2ULL, 4ULL, 8ULL, 16ULL, 32ULL, 64ULL);
+
+	dsa::Bounded_Queue<std::size_t> queue(1'024);
+
+	BENCHMARK(
+	    "Transfer " + std::to_string(element_count) + " values with "
+	    + std::to_string(thread_count) + " producers and consumers") {
+		return transfer(queue, thread_count);
+	};
+}
+
+} // namespace benchmark
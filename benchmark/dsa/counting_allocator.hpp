@@ -0,0 +1,65 @@
+#ifndef BENCHMARK_DSA_COUNTING_ALLOCATOR_HPP
+#define BENCHMARK_DSA_COUNTING_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <memory>
+
+namespace benchmark
+{
+
+/// @brief Holds the number of calls made through every Counting_Allocator
+/// which refers to it
+struct Allocation_Counter
+{
+	std::size_t allocations   = 0;
+	std::size_t deallocations = 0;
+};
+
+/// @brief Forwards to std::allocator while counting the number of calls made
+/// to allocate and deallocate
+template<typename Value_t>
+class Counting_Allocator
+{
+ public:
+	template<typename T>
+	using rebind = Counting_Allocator<T>;
+
+	using Value = Value_t;
+
+	Counting_Allocator() = default;
+
+	explicit Counting_Allocator(Allocation_Counter &counter) : m_counter(&counter) {
+	}
+
+	template<typename T>
+	explicit Counting_Allocator(Counting_Allocator<T> const &allocator)
+	    : m_counter(allocator.counter()) {
+	}
+
+	Value *allocate(std::size_t count) {
+		if (m_counter != nullptr)
+		{
+			m_counter->allocations++;
+		}
+		return std::allocator<Value>().allocate(count);
+	}
+
+	void deallocate(Value *pointer, std::size_t count) {
+		if (m_counter != nullptr)
+		{
+			m_counter->deallocations++;
+		}
+		std::allocator<Value>().deallocate(pointer, count);
+	}
+
+	[[nodiscard]] Allocation_Counter *counter() const {
+		return m_counter;
+	}
+
+ private:
+	Allocation_Counter *m_counter = nullptr;
+};
+
+} // namespace benchmark
+
+#endif
@@ -0,0 +1,103 @@
+#include <dsa/dynamic_array.hpp>
+#include <dsa/flat_hash_map.hpp>
+#include <dsa/hash_map.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace benchmark
+{
+
+namespace
+{
+
+using Key  = std::uint64_t;
+using Keys = dsa::Dynamic_Array<Key>;
+
+/// Runs the same operations on every kind of map, which all share the
+/// try_emplace, contains and erase members
+template<typename Map>
+void benchmark_map(std::string const &name, Keys const &keys, Keys const &misses) {
+	std::string const suffix = " on " + name + " with " + std::to_string(keys.size()) + " keys";
+
+	Map filled;
+	for (Key const key : keys)
+	{
+		filled.try_emplace(key, key);
+	}
+
+	BENCHMARK_ADVANCED("Insert" + suffix)(Catch::Benchmark::Chronometer meter) {
+		std::vector<Map> maps(static_cast<std::size_t>(meter.runs()));
+		meter.measure([&](int run) {
+			Map &map = maps[static_cast<std::size_t>(run)];
+			for (Key const key : keys)
+			{
+				map.try_emplace(key, key);
+			}
+			return map.size();
+		});
+	};
+
+	BENCHMARK("Find hit" + suffix) {
+		std::size_t found = 0;
+		for (Key const key : keys)
+		{
+			found += filled.contains(key);
+		}
+		return found;
+	};
+
+	BENCHMARK("Find miss" + suffix) {
+		std::size_t found = 0;
+		for (Key const key : misses)
+		{
+			found += filled.contains(key);
+		}
+		return found;
+	};
+
+	BENCHMARK_ADVANCED("Erase" + suffix)(Catch::Benchmark::Chronometer meter) {
+		std::vector<Map> maps(static_cast<std::size_t>(meter.runs()), filled);
+		meter.measure([&](int run) {
+			Map &map = maps[static_cast<std::size_t>(run)];
+			for (Key const key : keys)
+			{
+				map.erase(key);
+			}
+			return map.size();
+		});
+	};
+}
+
+/// Inserts random keys and looks up as many other random keys, the counts fill
+/// the flat maps to their maximum load of seven eighths
+void compare_hash_maps(std::size_t count) {
+	std::mt19937_64 generator(count);
+	Keys            keys(count);
+	Keys            misses(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		// The low bit tells the keys apart from the misses
+		keys[i]   = generator() | 1U;
+		misses[i] = generator() & ~Key{1};
+	}
+
+	benchmark_map<dsa::Flat_Hash_Map<Key, Key>>("Flat_Hash_Map", keys, misses);
+	benchmark_map<dsa::Hash_Map<Key, Key>>("Hash_Map", keys, misses);
+	benchmark_map<std::unordered_map<Key, Key>>("std::unordered_map", keys, misses);
+}
+
+} // namespace
+
+TEST_CASE("Flat hash map against std::unordered_map", "[flat_hash_map]") {
+	std::size_t const count = GENERATE(896ULL, 114'688ULL, 917'504ULL);
+	compare_hash_maps(count);
+}
+
+} // namespace benchmark
@@ -0,0 +1,89 @@
+#include <dsa/heap.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace benchmark
+{
+
+namespace
+{
+
+using Value = std::uint32_t;
+
+template<std::size_t Arity>
+using Heap = dsa::Heap<Value, decltype(std::less{}), dsa::Default_Allocator<Value>, Arity>;
+
+template<std::size_t Arity>
+using Indexed_Heap =
+    dsa::Indexed_Heap<Value, decltype(std::less{}), dsa::Default_Allocator<Value>, Arity>;
+
+std::vector<Value> random_values(std::size_t count) {
+	std::mt19937                         engine(count);
+	std::uniform_int_distribution<Value> distribution;
+
+	std::vector<Value> values(count);
+	for (Value &value : values)
+	{
+		value = distribution(engine);
+	}
+	return values;
+}
+
+/// @brief Times pushing every value and popping them all back, then times
+/// decreasing the key of each element of an indexed heap once
+template<std::size_t Arity>
+void benchmark_heap(std::vector<Value> const &values) {
+	std::string const suffix =
+	    " on a " + std::to_string(Arity) + "-ary heap of " + std::to_string(values.size());
+
+	BENCHMARK("Push and pop" + suffix) {
+		Heap<Arity> heap;
+		for (Value const value : values)
+		{
+			heap.push(value);
+		}
+
+		Value last = 0;
+		while (!heap.empty())
+		{
+			last = heap.top();
+			heap.pop();
+		}
+		return last;
+	};
+
+	BENCHMARK("Decrease keys" + suffix) {
+		Indexed_Heap<Arity>                               heap;
+		std::vector<typename Indexed_Heap<Arity>::Handle> handles;
+		handles.reserve(values.size());
+		for (Value const value : values)
+		{
+			handles.push_back(heap.push(value));
+		}
+
+		for (std::size_t i = 0; i < handles.size(); ++i)
+		{
+			heap.update(handles[i], values[i] / 2);
+		}
+		return heap.top();
+	};
+}
+
+} // namespace
+
+TEST_CASE("Heaps of different arities", "[heap]") {
+	std::size_t const        count  = GENERATE(10'000ULL, 1'000'000ULL);
+	std::vector<Value> const values = random_values(count);
+
+	benchmark_heap<2>(values);
+	benchmark_heap<4>(values);
+	benchmark_heap<8>(values);
+}
+
+} // namespace benchmark
@@ -0,0 +1,52 @@
+#include <dsa/algorithms.hpp>
+#include <dsa/dynamic_array.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace benchmark
+{
+
+namespace
+{
+
+/// Searches for a value placed in the last element, so every benchmark reads
+/// the whole range
+template<typename Value>
+void compare_linear_searches(std::size_t count, std::string const &type) {
+	dsa::Dynamic_Array<Value> values(count, Value{1});
+	values[count - 1] = Value{2};
+
+	std::string const suffix = " over " + std::to_string(count) + " " + type + " elements";
+
+	BENCHMARK("Vectorised linear search" + suffix) {
+		return dsa::linear_search(values.begin(), values.end(), Value{2});
+	};
+
+	BENCHMARK("Element wise linear search" + suffix) {
+		return dsa::linear_search(values.begin(), values.end(), [](Value const &value) {
+			return value <=> Value{2};
+		});
+	};
+
+	BENCHMARK("std::find" + suffix) {
+		return std::find(values.begin(), values.end(), Value{2});
+	};
+}
+
+} // namespace
+
+TEST_CASE("Linear search against an element wise search", "[linear_search]") {
+	std::size_t const count = GENERATE(64ULL, 4'096ULL, 1'000'000ULL);
+
+	compare_linear_searches<std::int8_t>(count, "int8");
+	compare_linear_searches<int>(count, "int");
+	compare_linear_searches<float>(count, "float");
+	compare_linear_searches<double>(count, "double");
+}
+
+} // namespace benchmark
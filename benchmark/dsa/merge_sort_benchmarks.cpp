@@ -0,0 +1,120 @@
+#include <dsa/algorithms.hpp>
+#include <dsa/default_allocator.hpp>
+#include <dsa/vector.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace benchmark
+{
+
+namespace
+{
+
+/// The recursive merge sort which the bottom up merge sort replaced, kept as
+/// a baseline. It copies half of the range into a new vector at every level
+/// and merges with swaps
+template<typename Iterator>
+void top_down_merge_sort(Iterator begin, Iterator end, auto const &comparator) {
+	using Value = typename std::iterator_traits<Iterator>::value_type;
+	using std::swap;
+
+	auto const difference = end - begin;
+	if (difference < 2)
+	{
+		return;
+	}
+
+	if (difference == 2)
+	{
+		if (!comparator(*begin, *(begin + 1)))
+		{
+			swap(*begin, *(begin + 1));
+		}
+		return;
+	}
+
+	Iterator const middle = begin + difference / 2;
+
+	dsa::Vector<Value, dsa::Default_Allocator<Value>> first_half;
+	first_half.append_range(std::make_move_iterator(begin), std::make_move_iterator(middle));
+
+	top_down_merge_sort(first_half.begin(), first_half.end(), comparator);
+	top_down_merge_sort(middle, end, comparator);
+
+	auto     first  = first_half.begin();
+	Iterator second = middle;
+	for (Iterator i = begin; i != end; ++i)
+	{
+		if (second == end || (first != first_half.end() && comparator(*first, *second)))
+		{
+			swap(*i, *first++);
+		}
+		else
+		{
+			swap(*i, *second++);
+		}
+	}
+}
+
+std::vector<int> random_values(std::size_t count) {
+	std::mt19937                       generator(count);
+	std::uniform_int_distribution<int> distribution;
+
+	std::vector<int> values(count);
+	std::generate(values.begin(), values.end(), [&] { return distribution(generator); });
+	return values;
+}
+
+/// Every benchmark sorts a fresh copy of the same values, so the cost of the
+/// copy is shared by all of them
+void compare_merge_sorts(std::size_t count) {
+	std::vector<int> const values = random_values(count);
+	std::string const      suffix = " of " + std::to_string(count) + " elements";
+
+	std::vector<int> sorted = values;
+	dsa::merge_sort(sorted.begin(), sorted.end());
+	CHECK(std::is_sorted(sorted.begin(), sorted.end()));
+
+	BENCHMARK("Bottom up merge sort" + suffix) {
+		std::vector<int> copy = values;
+		dsa::merge_sort(copy.begin(), copy.end());
+		return copy.front();
+	};
+
+	BENCHMARK("Top down merge sort" + suffix) {
+		std::vector<int> copy = values;
+		top_down_merge_sort(copy.begin(), copy.end(), std::less{});
+		return copy.front();
+	};
+
+	BENCHMARK("std::stable_sort" + suffix) {
+		std::vector<int> copy = values;
+		std::stable_sort(copy.begin(), copy.end());
+		return copy.front();
+	};
+}
+
+} // namespace
+
+TEST_CASE("Merge sort against the top down implementation", "[merge_sort]") {
+	std::size_t const count = GENERATE(1'000ULL, 100'000ULL, 1'000'000ULL);
+	compare_merge_sorts(count);
+}
+
+// Hidden by default as a single sample takes seconds, select it with the
+// [large] tag and lower --benchmark-samples
+TEST_CASE("Merge sort against the top down implementation on large ranges", "[.][large]") {
+	std::size_t const count = GENERATE(10'000'000ULL, 100'000'000ULL);
+	compare_merge_sorts(count);
+}
+
+} // namespace benchmark
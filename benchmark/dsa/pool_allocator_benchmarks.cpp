@@ -0,0 +1,138 @@
+#include <dsa/binary_tree.hpp>
+#include <dsa/default_allocator.hpp>
+#include <dsa/list.hpp>
+#include <dsa/pool_allocator.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+
+namespace benchmark
+{
+
+namespace
+{
+
+constexpr std::size_t count_bits = 12;
+constexpr std::size_t count      = std::size_t{1} << count_bits;
+
+/// Visits every value in [0, count) once in bit reversed order, so that the
+/// binary trees built from it are balanced
+constexpr int scattered(std::size_t i) {
+	std::size_t reversed = 0;
+	for (std::size_t bit = 0; bit < count_bits; ++bit)
+	{
+		reversed = (reversed << 1U) | ((i >> bit) & 1U);
+	}
+	return static_cast<int>(reversed);
+}
+
+template<typename Container>
+void fill_list(Container &list) {
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		list.prepend(scattered(i));
+	}
+}
+
+template<typename Container>
+void fill_tree(Container &binary_tree) {
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		binary_tree.insert(scattered(i));
+	}
+}
+
+template<typename Container>
+long long sum(Container const &container) {
+	long long total = 0;
+	for (int value : container)
+	{
+		total += value;
+	}
+	return total;
+}
+
+} // namespace
+
+TEST_CASE("Pool allocator against the default allocator for lists", "[pool_allocator]") {
+	using Default_List = dsa::List<int, dsa::Default_Allocator<int>>;
+	using Pool_List    = dsa::List<int, dsa::Pool_Allocator<int>>;
+
+	BENCHMARK("Insert and clear with the default allocator") {
+		Default_List list;
+		fill_list(list);
+		list.clear();
+		return list.empty();
+	};
+
+	BENCHMARK("Insert and clear with the pool allocator") {
+		Pool_List list;
+		fill_list(list);
+		list.clear();
+		return list.empty();
+	};
+
+	BENCHMARK("Refill a cleared list with the default allocator") {
+		Default_List list;
+		fill_list(list);
+		list.clear();
+		fill_list(list);
+		return list.empty();
+	};
+
+	BENCHMARK("Refill a cleared list with the pool allocator") {
+		Pool_List list;
+		fill_list(list);
+		list.clear();
+		fill_list(list);
+		return list.empty();
+	};
+
+	Default_List default_list;
+	Pool_List    pool_list;
+	fill_list(default_list);
+	fill_list(pool_list);
+
+	BENCHMARK("Iterate with the default allocator") {
+		return sum(default_list);
+	};
+
+	BENCHMARK("Iterate with the pool allocator") {
+		return sum(pool_list);
+	};
+}
+
+TEST_CASE("Pool allocator against the default allocator for binary trees", "[pool_allocator]") {
+	using Default_Tree = dsa::Binary_Tree<int, dsa::Default_Allocator<int>>;
+	using Pool_Tree    = dsa::Binary_Tree<int, dsa::Pool_Allocator<int>>;
+
+	BENCHMARK("Insert and clear with the default allocator") {
+		Default_Tree binary_tree;
+		fill_tree(binary_tree);
+		binary_tree.clear();
+		return binary_tree.empty();
+	};
+
+	BENCHMARK("Insert and clear with the pool allocator") {
+		Pool_Tree binary_tree;
+		fill_tree(binary_tree);
+		binary_tree.clear();
+		return binary_tree.empty();
+	};
+
+	Default_Tree default_tree;
+	Pool_Tree    pool_tree;
+	fill_tree(default_tree);
+	fill_tree(pool_tree);
+
+	BENCHMARK("Iterate with the default allocator") {
+		return sum(default_tree);
+	};
+
+	BENCHMARK("Iterate with the pool allocator") {
+		return sum(pool_tree);
+	};
+}
+
+} // namespace benchmark
@@ -0,0 +1,94 @@
+#include <dsa/ring_deque.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <thread>
+
+namespace benchmark
+{
+
+namespace
+{
+
+constexpr std::size_t operation_count = 1'000'000;
+
+/// @brief Slides a window of the given size along operation_count values,
+/// appending at the back and erasing at the front
+template<typename Deque>
+std::size_t slide_window(std::size_t window) {
+	Deque       deque;
+	std::size_t sum = 0;
+	for (std::size_t i = 0; i < operation_count; ++i)
+	{
+		if (deque.size() == window)
+		{
+			sum += deque.front();
+			deque.pop_front();
+		}
+		deque.emplace_back(i);
+	}
+	return sum;
+}
+
+/// @brief Hands operation_count values from a producer thread to the calling
+/// thread through a ring of the given capacity
+std::size_t hand_off(std::size_t capacity) {
+	dsa::Ring_Deque<std::size_t> deque;
+	deque.reserve(capacity);
+
+	std::thread producer([&deque] {
+		for (std::size_t i = 0; i < operation_count; ++i)
+		{
+			while (!deque.try_push(std::size_t{i}))
+			{
+				std::this_thread::yield();
+			}
+		}
+	});
+
+	std::size_t sum    = 0;
+	std::size_t popped = 0;
+	while (popped < operation_count)
+	{
+		if (auto const value = deque.try_pop())
+		{
+			sum += *value;
+			++popped;
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+	producer.join();
+	return sum;
+}
+
+} // namespace
+
+TEST_CASE("Ring deque against std::deque", "[ring_deque]") {
+	std::size_t const window = GENERATE(16ULL, 4'096ULL);
+	std::string const suffix = " with a window of " + std::to_string(window);
+
+	BENCHMARK("Slide std::deque" + suffix) {
+		return slide_window<std::deque<std::size_t>>(window);
+	};
+
+	BENCHMARK("Slide Ring_Deque" + suffix) {
+		return slide_window<dsa::Ring_Deque<std::size_t>>(window);
+	};
+}
+
+TEST_CASE("Ring deque handing values between two threads", "[ring_deque]") {
+	std::size_t const capacity = GENERATE(64ULL, 4'096ULL);
+
+	BENCHMARK("Hand off " + std::to_string(operation_count) + " values through a ring of "
+	          + std::to_string(capacity)) {
+		return hand_off(capacity);
+	};
+}
+
+} // namespace benchmark
@@ -0,0 +1,58 @@
+#include "counting_allocator.hpp"
+
+#include <dsa/list.hpp>
+#include <dsa/unrolled_list.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace benchmark
+{
+
+namespace
+{
+
+using Value = std::uint32_t;
+
+/// @brief Appends count values to a list using a Counting_Allocator, reports
+/// how many allocations that took, and times summing the list
+template<typename List>
+void benchmark_list(std::string const &name, std::size_t count) {
+	std::string const suffix = " on " + name + " with " + std::to_string(count) + " values";
+
+	Allocation_Counter counter;
+	List               list{Counting_Allocator<Value>(counter)};
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		list.append(static_cast<Value>(i));
+	}
+	WARN("Allocations" << suffix << ": " << counter.allocations);
+
+	BENCHMARK("Iterate" + suffix) {
+		Value sum = 0;
+		for (Value const value : list)
+		{
+			sum += value;
+		}
+		return sum;
+	};
+}
+
+} // namespace
+
+TEST_CASE("Unrolled list against a linked list", "[unrolled_list]") {
+	std::size_t const count = GENERATE(10'000ULL, 1'000'000ULL);
+
+	benchmark_list<dsa::List<Value, Counting_Allocator<Value>>>("List", count);
+	benchmark_list<dsa::Unrolled_List<Value, 16, Counting_Allocator<Value>>>(
+	    "Unrolled_List of 16 values per node",
+	    count);
+	benchmark_list<dsa::Unrolled_List<Value, 64, Counting_Allocator<Value>>>(
+	    "Unrolled_List of 64 values per node",
+	    count);
+}
+
+} // namespace benchmark
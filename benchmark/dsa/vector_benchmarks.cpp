@@ -0,0 +1,98 @@
+#include "counting_allocator.hpp"
+
+#include <dsa/growth_policy.hpp>
+#include <dsa/vector.hpp>
+
+#include <catch2/catch_all.hpp>
+
+namespace benchmark
+{
+
+namespace
+{
+
+constexpr std::size_t cycles = 64;
+constexpr std::size_t count  = 4'096;
+
+/// Simulates a queue which is repeatedly drained and refilled, returning the
+/// number of allocations made
+template<typename Growth_Policy>
+std::size_t drain_and_refill() {
+	using Vector = dsa::Vector<int, Counting_Allocator<int>, Growth_Policy>;
+
+	Allocation_Counter counter;
+	Vector             vector{Counting_Allocator<int>(counter)};
+	for (std::size_t cycle = 0; cycle < cycles; ++cycle)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			vector.append(static_cast<int>(i));
+		}
+
+		while (!vector.empty())
+		{
+			vector.erase(vector.size() - 1);
+		}
+	}
+	return counter.allocations;
+}
+
+/// Repeatedly resizes a vector between an empty and a full state, returning
+/// the number of allocations made
+template<typename Growth_Policy>
+std::size_t oscillating_resize() {
+	using Vector = dsa::Vector<int, Counting_Allocator<int>, Growth_Policy>;
+
+	Allocation_Counter counter;
+	Vector             vector{Counting_Allocator<int>(counter)};
+	for (std::size_t cycle = 0; cycle < cycles; ++cycle)
+	{
+		vector.resize(count);
+		vector.resize(count / 8);
+	}
+	return counter.allocations;
+}
+
+} // namespace
+
+TEST_CASE("Vector growth policies on a draining and refilling workload", "[vector]") {
+	std::size_t const by_default     = drain_and_refill<dsa::Default_Growth_Policy>();
+	std::size_t const never_shrink   = drain_and_refill<dsa::Never_Shrink_Growth_Policy>();
+	std::size_t const one_and_a_half = drain_and_refill<dsa::One_And_A_Half_Growth_Policy>();
+
+	WARN("Default allocations: " << by_default);
+	WARN("Never shrink allocations: " << never_shrink);
+	WARN("One and a half allocations: " << one_and_a_half);
+	CHECK(never_shrink < by_default);
+
+	BENCHMARK("Default growth policy") {
+		return drain_and_refill<dsa::Default_Growth_Policy>();
+	};
+
+	BENCHMARK("Never shrink growth policy") {
+		return drain_and_refill<dsa::Never_Shrink_Growth_Policy>();
+	};
+
+	BENCHMARK("One and a half growth policy") {
+		return drain_and_refill<dsa::One_And_A_Half_Growth_Policy>();
+	};
+}
+
+TEST_CASE("Vector growth policies on an oscillating resize workload", "[vector]") {
+	std::size_t const by_default   = oscillating_resize<dsa::Default_Growth_Policy>();
+	std::size_t const never_shrink = oscillating_resize<dsa::Never_Shrink_Growth_Policy>();
+
+	WARN("Default allocations: " << by_default);
+	WARN("Never shrink allocations: " << never_shrink);
+	CHECK(never_shrink < by_default);
+
+	BENCHMARK("Default growth policy") {
+		return oscillating_resize<dsa::Default_Growth_Policy>();
+	};
+
+	BENCHMARK("Never shrink growth policy") {
+		return oscillating_resize<dsa::Never_Shrink_Growth_Policy>();
+	};
+}
+
+} // namespace benchmark
@@ -4,8 +4,9 @@ set(CPP_PROJECT_TEMPLATE_USING_CATCH FALSE)
 macro(ENABLE_TESTS)
 	option(DSA_STATIC_TESTS "Compile dsa static tests" FALSE)
 	option(DSA_STATIC_DEBUG_TESTS "Compile dsa static tests into an executable for debugging" FALSE)
+	option(DSA_BENCHMARKS "Compile dsa benchmarks" FALSE)
 
-	set(CPP_PROJECT_TEMPLATE_USING_CATCH ${DSA_STATIC_TESTS} OR ${DSA_STATIC_DEBUG_TESTS})
+	set(CPP_PROJECT_TEMPLATE_USING_CATCH ${DSA_STATIC_TESTS} OR ${DSA_STATIC_DEBUG_TESTS} OR ${DSA_BENCHMARKS})
 
 	if(${CPP_PROJECT_TEMPLATE_USING_CATCH})
 		enable_testing()
@@ -1,10 +1,28 @@
 #ifndef DSA_ALGORITHMS_HPP
 #define DSA_ALGORITHMS_HPP
 
+#include <dsa/arena_allocator.hpp>
+#include <dsa/dynamic_array.hpp>
+#include <dsa/hash_map.hpp>
+#include <dsa/monotonic_buffer.hpp>
+#include <dsa/partition_point.hpp>
+#include <dsa/simd_search.hpp>
 #include <dsa/vector.hpp>
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
 #include <optional>
+#include <ranges>
+#include <type_traits>
 #include <utility>
 
 namespace dsa
@@ -90,12 +108,11 @@ bool is_sorted(Iterator begin, Iterator end) {
 
 /**
  *  @brief Uses insertion sort on the given range such that each pair satisfies
- *  comparator(first, second)
+ *  comparator(first, second). Each element is moved past the elements which
+ *  compare greater than it, so equal elements keep their relative order
  */
 template<typename Iterator>
 void insertion_sort(Iterator begin, Iterator end, auto const &comparator) {
-	using std::swap;
-
 	if (begin == end)
 	{
 		return;
@@ -103,10 +120,18 @@ void insertion_sort(Iterator begin, Iterator end, auto const &comparator) {
 
 	for (auto i = begin + 1; i != end; ++i)
 	{
-		for (auto j = i; j != begin && !comparator(*(j - 1), *j); --j)
+		if (!comparator(*i, *(i - 1)))
 		{
-			swap(*(j - 1), *j);
+			continue;
 		}
+
+		auto value = std::move(*i);
+		auto j     = i;
+		for (; j != begin && comparator(value, *(j - 1)); --j)
+		{
+			*j = std::move(*(j - 1));
+		}
+		*j = std::move(value);
 	}
 }
 
@@ -156,65 +181,521 @@ void selection_sort(Iterator begin, Iterator end) {
 	return selection_sort(begin, end, std::less{});
 }
 
+namespace detail
+{
+
+/**
+ * @brief Runs of up to this many elements are sorted with insertion sort
+ * before merge sort starts merging them
+ */
+constexpr std::ptrdiff_t merge_sort_insertion_cutoff = 16;
+
+/**
+ * @brief Merges the sorted runs [begin, middle) and [middle, end) in place.
+ * The shorter run is moved into the scratch vector and merged back from the
+ * side it was taken from, so the scratch never needs to hold more than half
+ * of the merged range. Elements of the first run are taken first when equal
+ * which keeps the merge stable
+ */
+template<typename Iterator, typename Scratch>
+void merge_adjacent_runs(
+    Iterator    begin,
+    Iterator    middle,
+    Iterator    end,
+    Scratch    &scratch,
+    auto const &comparator) {
+	if (!comparator(*middle, *(middle - 1)))
+	{
+		return;
+	}
+
+	if (middle - begin <= end - middle)
+	{
+		scratch.append_range(
+		    std::make_move_iterator(begin),
+		    std::make_move_iterator(middle));
+
+		auto     first = scratch.begin();
+		Iterator next  = begin;
+		while (first != scratch.end() && middle != end)
+		{
+			if (comparator(*middle, *first))
+			{
+				*next++ = std::move(*middle++);
+			}
+			else
+			{
+				*next++ = std::move(*first++);
+			}
+		}
+		std::move(first, scratch.end(), next);
+	}
+	else
+	{
+		scratch.append_range(
+		    std::make_move_iterator(middle),
+		    std::make_move_iterator(end));
+
+		auto     second = scratch.end();
+		Iterator next   = end;
+		while (second != scratch.begin() && middle != begin)
+		{
+			if (comparator(*(second - 1), *(middle - 1)))
+			{
+				*--next = std::move(*--middle);
+			}
+			else
+			{
+				*--next = std::move(*--second);
+			}
+		}
+		std::move_backward(scratch.begin(), second, next);
+	}
+	scratch.clear();
+}
+
+/**
+ * @brief Sorts runs of a few elements with insertion sort and then merges them
+ * bottom up. The scratch vector is only created, through make_scratch, if the
+ * range is longer than a single run and is asked to hold half of the range
+ */
+template<typename Iterator>
+void bottom_up_merge_sort(
+    Iterator    begin,
+    Iterator    end,
+    auto const &comparator,
+    auto const &make_scratch) {
+	using Difference = typename std::iterator_traits<Iterator>::difference_type;
+
+	Difference const size   = end - begin;
+	Difference const cutoff = merge_sort_insertion_cutoff;
+	for (Difference run = 0; run < size; run += cutoff)
+	{
+		insertion_sort(begin + run, begin + std::min(run + cutoff, size), comparator);
+	}
+
+	if (size <= cutoff)
+	{
+		return;
+	}
+
+	auto scratch = make_scratch(static_cast<std::size_t>(size / 2));
+	for (Difference width = cutoff; width < size; width *= 2)
+	{
+		for (Difference first = 0; first < size - width; first += 2 * width)
+		{
+			Difference const last = std::min(first + 2 * width, size);
+			merge_adjacent_runs(
+			    begin + first,
+			    begin + first + width,
+			    begin + last,
+			    scratch,
+			    comparator);
+		}
+	}
+}
+
+} // namespace detail
+
 /**
  *  @brief Uses merge sort on the given range such that each pair satisfies
- *  comparator(first, second)
+ *  comparator(first, second). The sort is stable and iterative: runs of a few
+ *  elements are sorted with insertion sort and then merged bottom up through a
+ *  single scratch vector. The scratch vector is allocated from the given
+ *  buffer, which is not asked for more memory if it has space for
+ *  (end - begin) / 2 elements
+ */
+template<typename Iterator, typename Upstream_Allocator>
+void merge_sort(
+    Iterator                              begin,
+    Iterator                              end,
+    auto const                           &comparator,
+    Monotonic_Buffer<Upstream_Allocator> &buffer) {
+	using Value     = typename std::iterator_traits<Iterator>::value_type;
+	using Allocator = Arena_Allocator<Value, Upstream_Allocator>;
+
+	detail::bottom_up_merge_sort(begin, end, comparator, [&buffer](std::size_t capacity) {
+		dsa::Vector<Value, Allocator> scratch{Allocator(buffer)};
+		scratch.reserve(capacity);
+		return scratch;
+	});
+}
+
+/**
+ *  @brief Uses merge sort on the given range such that each pair satisfies
+ *  comparator(first, second). The scratch vector is allocated once, up front,
+ *  with the given allocator
  */
 template<typename Iterator, typename Allocator = Default_Allocator<typename std::iterator_traits<Iterator>::value_type>>
 void merge_sort(Iterator begin, Iterator end, auto const &comparator) {
-	using Traits = std::iterator_traits<Iterator>;
+	using Value = typename std::iterator_traits<Iterator>::value_type;
+
+	detail::bottom_up_merge_sort(begin, end, comparator, [](std::size_t capacity) {
+		dsa::Vector<Value, Allocator> scratch;
+		scratch.reserve(capacity);
+		return scratch;
+	});
+}
+
+/**
+ *  @brief Uses merge sort to sort the given range in ascending order
+ */
+template<typename Iterator, typename Allocator = Default_Allocator<typename std::iterator_traits<Iterator>::value_type>>
+void merge_sort(Iterator begin, Iterator end) {
+	return merge_sort<Iterator, Allocator>(begin, end, std::less{});
+}
+
+namespace detail
+{
+
+/**
+ * @brief Moves the element at index down the heap of the given size until
+ * neither of its children compares greater than it
+ */
+template<typename Iterator, typename Difference>
+void sift_down(Iterator begin, Difference size, Difference index, auto const &comparator) {
 	using std::swap;
 
-	auto const difference = end - begin;
-	if (difference < 2)
+	for (Difference child = 2 * index + 1; child < size; child = 2 * index + 1)
 	{
-		return;
+		if (child + 1 < size && comparator(*(begin + child), *(begin + child + 1)))
+		{
+			++child;
+		}
+
+		if (!comparator(*(begin + index), *(begin + child)))
+		{
+			return;
+		}
+
+		swap(*(begin + index), *(begin + child));
+		index = child;
+	}
+}
+
+} // namespace detail
+
+/**
+ *  @brief Uses heap sort on the given range such that each pair satisfies
+ *  comparator(first, second). The sort does not allocate and takes
+ *  O(n log n) time regardless of the input
+ */
+template<typename Iterator>
+void heap_sort(Iterator begin, Iterator end, auto const &comparator) {
+	using std::swap;
+
+	auto size = end - begin;
+	for (auto parent = size / 2; parent > 0; --parent)
+	{
+		detail::sift_down(begin, size, parent - 1, comparator);
+	}
+
+	while (size > 1)
+	{
+		--size;
+		swap(*begin, *(begin + size));
+		detail::sift_down(begin, size, decltype(size){0}, comparator);
+	}
+}
+
+/**
+ *  @brief Uses heap sort to sort the given range in ascending order
+ */
+template<typename Iterator>
+void heap_sort(Iterator begin, Iterator end) {
+	return heap_sort(begin, end, std::less{});
+}
+
+namespace detail
+{
+
+/**
+ * @brief Partitions of up to this many elements are left for a final
+ * insertion sort pass
+ */
+constexpr std::ptrdiff_t quick_sort_insertion_cutoff = 16;
+
+/**
+ * @brief Partitions larger than this use the median of three medians as the
+ * pivot, which guards better against patterns in the input
+ */
+constexpr std::ptrdiff_t quick_sort_ninther_threshold = 128;
+
+template<typename Iterator>
+void sort_three(Iterator first, Iterator second, Iterator third, auto const &comparator) {
+	using std::swap;
+
+	if (comparator(*second, *first))
+	{
+		swap(*first, *second);
+	}
+
+	if (comparator(*third, *second))
+	{
+		swap(*second, *third);
+		if (comparator(*second, *first))
+		{
+			swap(*first, *second);
+		}
+	}
+}
+
+/**
+ * @brief Moves the chosen pivot to begin. An element which does not compare
+ * greater than the pivot is left after begin and one which does not compare
+ * less is left before end, so the partition scans need no bounds checks
+ */
+template<typename Iterator>
+void move_pivot_to_begin(Iterator begin, Iterator end, auto const &comparator) {
+	using std::swap;
+
+	auto const     size   = end - begin;
+	Iterator const middle = begin + size / 2;
+	if (size > quick_sort_ninther_threshold)
+	{
+		sort_three(begin, middle, end - 1, comparator);
+		sort_three(begin + 1, middle - 1, end - 2, comparator);
+		sort_three(begin + 2, middle + 1, end - 3, comparator);
+		sort_three(middle - 1, middle, middle + 1, comparator);
+		swap(*begin, *middle);
+	}
+	else
+	{
+		sort_three(middle, begin, end - 1, comparator);
+	}
+}
+
+/**
+ * @brief Partitions (begin, end) around the pivot at begin
+ * @return The first element of the partition which does not compare less
+ * than the pivot
+ */
+template<typename Iterator>
+Iterator partition_around_begin(Iterator begin, Iterator end, auto const &comparator) {
+	using std::swap;
+
+	Iterator left  = begin + 1;
+	Iterator right = end;
+	while (true)
+	{
+		while (comparator(*left, *begin))
+		{
+			++left;
+		}
+
+		--right;
+		while (comparator(*begin, *right))
+		{
+			--right;
+		}
+
+		if (!(left < right))
+		{
+			return left;
+		}
+
+		swap(*left, *right);
+		++left;
 	}
+}
 
-	if (difference == 2)
+template<typename Iterator>
+void introsort_loop(Iterator begin, Iterator end, int depth_limit, auto const &comparator) {
+	while (end - begin > quick_sort_insertion_cutoff)
 	{
-		if (!comparator(*begin, *(begin + 1)))
+		if (depth_limit == 0)
+		{
+			heap_sort(begin, end, comparator);
+			return;
+		}
+		--depth_limit;
+
+		move_pivot_to_begin(begin, end, comparator);
+		Iterator const cut = partition_around_begin(begin, end, comparator);
+
+		// Recursing into the smaller partition bounds the stack depth
+		if (cut - begin < end - cut)
+		{
+			introsort_loop(begin, cut, depth_limit, comparator);
+			begin = cut;
+		}
+		else
 		{
-			swap(*begin, *(begin + 1));
+			introsort_loop(cut, end, depth_limit, comparator);
+			end = cut;
 		}
+	}
+}
+
+} // namespace detail
+
+/**
+ *  @brief Uses quick sort on the given range such that each pair satisfies
+ *  comparator(first, second). The sort is unstable and does not allocate.
+ *  Pivots are the median of three elements, or of three medians on large
+ *  partitions. Partitions which recurse too deeply fall back to heap sort,
+ *  bounding the sort to O(n log n), and small partitions are left for a
+ *  final insertion sort pass
+ */
+template<typename Iterator>
+void quick_sort(Iterator begin, Iterator end, auto const &comparator) {
+	auto const size = end - begin;
+	if (size < 2)
+	{
 		return;
 	}
 
-	auto const     half   = difference / 2;
-	Iterator const middle = begin + half;
+	auto const depth = static_cast<int>(std::bit_width(static_cast<std::size_t>(size)));
+	detail::introsort_loop(begin, end, 2 * depth, comparator);
+	insertion_sort(begin, end, comparator);
+}
 
-	// TODO: implement inplace merge sort
-	dsa::Vector<typename Traits::value_type, Allocator> first_half;
-	first_half.reserve(static_cast<size_t>(half));
-	for (auto i = begin; i != middle; ++i)
+/**
+ *  @brief Uses quick sort to sort the given range in ascending order
+ */
+template<typename Iterator>
+void quick_sort(Iterator begin, Iterator end) {
+	return quick_sort(begin, end, std::less{});
+}
+
+namespace detail
+{
+
+/**
+ * @brief Keys which radix sort can order by their bytes once they are
+ * mapped with radix_sort_bits
+ */
+template<typename Key>
+concept Radix_Sort_Key = (std::integral<Key> && !std::same_as<Key, bool>)
+                      || (std::floating_point<Key> && (sizeof(Key) == 4 || sizeof(Key) == 8));
+
+/**
+ * @brief Maps a key onto an unsigned integer of the same size whose order
+ * matches the order of the keys. The sign bit of signed integers is flipped.
+ * Negative floating point values have every bit flipped since their
+ * magnitude grows in the opposite direction, so -0.0 is placed before 0.0 and
+ * NaNs at either end depending on their sign
+ */
+template<Radix_Sort_Key Key>
+constexpr auto radix_sort_bits(Key key) {
+	if constexpr (std::floating_point<Key>)
 	{
-		first_half.append(std::move(*i));
+		using Bits = std::conditional_t<sizeof(Key) == 4, std::uint32_t, std::uint64_t>;
+
+		constexpr Bits sign = Bits{1} << (sizeof(Bits) * CHAR_BIT - 1);
+		auto const     bits = std::bit_cast<Bits>(key);
+		if ((bits & sign) != 0)
+		{
+			return static_cast<Bits>(~bits);
+		}
+		return static_cast<Bits>(bits | sign);
 	}
+	else
+	{
+		using Bits = std::make_unsigned_t<Key>;
 
-	merge_sort<Iterator, Allocator>(first_half.begin(), first_half.end(), comparator);
-	merge_sort<Iterator, Allocator>(middle, end, comparator);
+		constexpr Bits high_bit = Bits{1} << (sizeof(Bits) * CHAR_BIT - 1);
+		constexpr Bits sign     = std::is_signed_v<Key> ? high_bit : 0;
+		return static_cast<Bits>(static_cast<Bits>(key) ^ sign);
+	}
+}
+
+} // namespace detail
+
+/**
+ *  @brief Uses least significant digit radix sort to order the given range by
+ *  the integral or floating point key returned by key_extractor(element). The
+ *  sort is stable and runs one counting pass over the range followed by a
+ *  scatter pass for every byte of the key, skipping bytes which every key
+ *  shares. Elements are moved back and forth between the range and a single
+ *  scratch array, which requires them to be default constructible
+ */
+template<typename Iterator, typename Key_Extractor, typename Allocator = Default_Allocator<typename std::iterator_traits<Iterator>::value_type>>
+void radix_sort(Iterator begin, Iterator end, Key_Extractor const &key_extractor) {
+	using Value  = typename std::iterator_traits<Iterator>::value_type;
+	using Result = std::invoke_result_t<Key_Extractor const &, Value const &>;
+	using Key    = std::remove_cvref_t<Result>;
+	static_assert(detail::Radix_Sort_Key<Key>, "Keys must be integral or floating point");
+
+	constexpr std::size_t bits_per_pass = 8;
+	constexpr std::size_t passes        = sizeof(Key);
+	constexpr std::size_t buckets       = std::size_t{1} << bits_per_pass;
+
+	auto const size = static_cast<std::size_t>(end - begin);
+	if (size < 2)
+	{
+		return;
+	}
+
+	auto bucket_of_bits = [](auto bits, std::size_t pass) {
+		return static_cast<std::size_t>(bits >> (pass * bits_per_pass)) & (buckets - 1);
+	};
 
-	auto     first  = first_half.begin();
-	Iterator second = middle;
+	auto bucket_of = [&](Value const &value, std::size_t pass) {
+		auto const bits = detail::radix_sort_bits(std::invoke(key_extractor, value));
+		return bucket_of_bits(bits, pass);
+	};
+
+	std::array<std::array<std::size_t, buckets>, passes> counts{};
 	for (Iterator i = begin; i != end; ++i)
 	{
-		if (second == end || (first != first_half.end() && comparator(*first, *second)))
+		auto const bits = detail::radix_sort_bits(std::invoke(key_extractor, *i));
+		for (std::size_t pass = 0; pass < passes; ++pass)
+		{
+			++counts[pass][bucket_of_bits(bits, pass)];
+		}
+	}
+
+	std::array<std::size_t, passes> first_buckets{};
+	for (std::size_t pass = 0; pass < passes; ++pass)
+	{
+		first_buckets[pass] = bucket_of(*begin, pass);
+	}
+
+	auto scatter = [&](auto source, auto source_end, auto destination, std::size_t pass) {
+		std::array<std::size_t, buckets> offsets{};
+		auto const &count = counts[pass];
+		std::exclusive_scan(count.begin(), count.end(), offsets.begin(), std::size_t{0});
+		for (; source != source_end; ++source)
+		{
+			destination[offsets[bucket_of(*source, pass)]++] = std::move(*source);
+		}
+	};
+
+	dsa::Dynamic_Array<Value, Allocator> scratch(size);
+	bool                                 in_scratch = false;
+	for (std::size_t pass = 0; pass < passes; ++pass)
+	{
+		// A byte which every key shares leaves the order unchanged
+		if (counts[pass][first_buckets[pass]] == size)
+		{
+			continue;
+		}
+
+		if (in_scratch)
 		{
-			swap(*i, *first++);
+			scatter(scratch.begin(), scratch.end(), begin, pass);
 		}
 		else
 		{
-			swap(*i, *second++);
+			scatter(begin, end, scratch.begin(), pass);
 		}
+		in_scratch = !in_scratch;
+	}
+
+	if (in_scratch)
+	{
+		std::move(scratch.begin(), scratch.end(), begin);
 	}
 }
 
 /**
- *  @brief Uses merge sort to sort the given range in ascending order
+ *  @brief Uses least significant digit radix sort to sort the given range of
+ *  integral or floating point values in ascending order
  */
-template<typename Iterator, typename Allocator = Default_Allocator<typename std::iterator_traits<Iterator>::value_type>>
-void merge_sort(Iterator begin, Iterator end) {
-	return merge_sort<Iterator, Allocator>(begin, end, std::less{});
+template<typename Iterator>
+void radix_sort(Iterator begin, Iterator end) {
+	return radix_sort(begin, end, std::identity{});
 }
 
 /**
@@ -235,47 +716,80 @@ auto linear_search(Iterator begin, Iterator end, auto const &predicate) -> std::
 }
 
 /**
- *  @brief Uses linear search to find an element in the given range
+ *  @brief Uses linear search to find an element in the given range. Ranges of
+ *  integral or floating point values behind raw pointers compare a vector
+ *  register of elements at a time, using the widest instruction set the CPU
+ *  supports
  *  @return An empty std::optional if no element is found, otherwise it contains
  *  the iterator of the value in the range
  */
 template<typename Iterator, typename Traits = std::iterator_traits<Iterator>>
 auto linear_search(Iterator begin, Iterator end, typename Traits::value_type const &value)
     -> std::optional<Iterator> {
-	return linear_search(begin, end, [&](typename Traits::value_type const &other) {
-		return other <=> value;
+	using Value = typename Traits::value_type;
+
+	constexpr bool vectorisable =
+	    detail::Simd_Searchable<Value> && std::is_convertible_v<Iterator, Value const *>;
+	if constexpr (vectorisable)
+	{
+		Value const *const found = detail::find_equal<Value>(begin, end, value);
+		if (found == end)
+		{
+			return {};
+		}
+		return begin + (found - begin);
+	}
+	else
+	{
+		return linear_search(begin, end, [&](Value const &other) {
+			return other <=> value;
+		});
+	}
+}
+
+/**
+ *  @brief Finds the first element in the given sorted range which does not
+ *  satisfy comparator(element, value), see partition_point
+ *  @return The first element not ordered before value, or end
+ */
+template<typename Iterator, typename Traits = std::iterator_traits<Iterator>>
+Iterator lower_bound(
+    Iterator                           begin,
+    Iterator                           end,
+    typename Traits::value_type const &value,
+    auto const                        &comparator) {
+	return partition_point(begin, end, [&](typename Traits::value_type const &element) {
+		return comparator(element, value);
 	});
 }
 
 /**
- *  @brief Uses binary search to find an element in the given range
+ *  @brief Finds the first element in the given range sorted in ascending order
+ *  which is not less than value
+ *  @return The first element not less than value, or end
+ */
+template<typename Iterator, typename Traits = std::iterator_traits<Iterator>>
+Iterator lower_bound(Iterator begin, Iterator end, typename Traits::value_type const &value) {
+	return lower_bound(begin, end, value, std::less{});
+}
+
+/**
+ *  @brief Uses binary search to find an element in the given range, see
+ *  partition_point
  *  @return An empty std::optional if no element is found, otherwise it contains
- *  the iterator of the value in the range
+ *  the iterator of the first matching value in the range
  */
 template<typename Iterator, typename Traits = std::iterator_traits<Iterator>>
 auto binary_search(Iterator begin, Iterator end, auto const &predicate) -> std::optional<Iterator> {
-	while (begin != end)
-	{
-		// We want to round down so that we stay in the begin, end - 1
-		// range
-		auto                 distance = (end - begin) & (~1U);
-		Iterator             mid      = begin + (distance / 2);
-		std::strong_ordering order    = predicate(*mid);
-		if (std::is_eq(order))
-		{
-			return mid;
-		}
-
-		if (std::is_gt(order))
-		{
-			end = mid;
-		}
-		else
-		{
-			begin = mid + 1;
-		}
+	Iterator const found =
+	    partition_point(begin, end, [&](typename Traits::value_type const &element) {
+		    return std::is_lt(predicate(element));
+	    });
+	if (found == end || !std::is_eq(predicate(*found)))
+	{
+		return {};
 	}
-	return {};
+	return found;
 }
 
 /**
@@ -292,42 +806,53 @@ auto binary_search(Iterator begin, Iterator end, typename Traits::value_type con
 }
 
 /**
- *  @brief Uses sort and binary search in order to find two elements that add up
- *  the the given sum
+ *  @brief Finds two elements that add up to the given sum in a single pass,
+ *  looking up the complement of every element in a hash map of the elements
+ *  before it. The map is allocated from the given buffer, which is not asked
+ *  for more memory if it has space for
+ *  Hash_Map<Value, Iterator>::allocation_size(end - begin) bytes
  *  @return An empty std::optional if no such elements are found, otherwise it
  *  contains a pair of two iterators whose sum add up to the given value
- *
- *  TODO: This can be done with a Hashmap, but since we did not implement it
- *  yet we use the sort + binary search version
  */
-template<typename Iterator, typename Traits = std::iterator_traits<Iterator>>
-auto sum_components_search(Iterator begin, Iterator end, typename Traits::value_type const &value)
-    -> std::optional<std::pair<Iterator, Iterator>> {
-	dsa::Vector<Iterator> sorted_iterators;
-	sorted_iterators.reserve(static_cast<size_t>(end - begin));
-	for (auto i = begin; i != end; ++i)
-	{
-		sorted_iterators.append(i);
-	}
-	merge_sort(
-	    sorted_iterators.begin(),
-	    sorted_iterators.end(),
-	    [](Iterator const &lhs, Iterator const &rhs) { return *lhs < *rhs; });
-
-	for (auto i = sorted_iterators.begin(); i != sorted_iterators.end(); ++i)
+template<typename Iterator, typename Upstream_Allocator, typename Traits = std::iterator_traits<Iterator>>
+auto sum_components_search(
+    Iterator                              begin,
+    Iterator                              end,
+    typename Traits::value_type const    &value,
+    Monotonic_Buffer<Upstream_Allocator> &buffer) -> std::optional<std::pair<Iterator, Iterator>> {
+	using Value     = typename Traits::value_type;
+	using Allocator = Arena_Allocator<std::pair<Value, Iterator>, Upstream_Allocator>;
+	using Seen = Hash_Map<Value, Iterator, std::hash<Value>, std::equal_to<Value>, Allocator>;
+
+	Seen seen(static_cast<std::size_t>(end - begin), Allocator(buffer));
+	for (Iterator i = begin; i != end; ++i)
 	{
-		auto complement =
-		    binary_search(i + 1, sorted_iterators.end(), [&](Iterator const &it) {
-			    return **i + *it <=> value;
-		    });
-		if (complement.has_value())
+		auto const complement = seen.find(value - *i);
+		if (complement != seen.end())
 		{
-			return std::pair{*i, *complement.value()};
+			return std::pair{i, complement->second};
 		}
+		seen.insert(*i, i);
 	}
 	return {};
 }
 
+/**
+ *  @brief Finds two elements that add up to the given sum in a single pass
+ *  over the range, allocating the hash map it uses once up front
+ *  @return An empty std::optional if no such elements are found, otherwise it
+ *  contains a pair of two iterators whose sum add up to the given value
+ */
+template<typename Iterator, typename Traits = std::iterator_traits<Iterator>>
+auto sum_components_search(Iterator begin, Iterator end, typename Traits::value_type const &value)
+    -> std::optional<std::pair<Iterator, Iterator>> {
+	using Seen = Hash_Map<typename Traits::value_type, Iterator>;
+
+	auto const         size = static_cast<std::size_t>(end - begin);
+	Monotonic_Buffer<> buffer(Seen::allocation_size(size));
+	return sum_components_search(begin, end, value, buffer);
+}
+
 } // namespace dsa
 
 #endif
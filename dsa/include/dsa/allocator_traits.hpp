@@ -68,6 +68,17 @@ class Allocator_Traits_Base
 		return Detect_V<Has_Deallocate_Operator, Allocator, Pointer>;
 	}
 
+	template<typename Allocator, typename Pointer>
+	using Has_Expand_In_Place_Operator = decltype(std::declval<Allocator &&>().expand_in_place(
+	    std::declval<Pointer &&>(),
+	    std::size_t(),
+	    std::size_t()));
+
+	template<typename Allocator, typename Pointer>
+	static constexpr bool has_expand_in_place() {
+		return Detect_V<Has_Expand_In_Place_Operator, Allocator, Pointer>;
+	}
+
 	template<typename Allocator, typename Pointer>
 	using Has_Destroy_Operator =
 	    decltype(std::declval<Allocator>().destroy(std::declval<Pointer &&>()));
@@ -76,6 +87,15 @@ class Allocator_Traits_Base
 	static constexpr bool has_destroy() {
 		return Detect_V<Has_Destroy_Operator, Allocator, Pointer>;
 	}
+
+	template<typename Allocator>
+	using Has_Equal_Operator =
+	    decltype(std::declval<Allocator const &>() == std::declval<Allocator const &>());
+
+	template<typename Allocator>
+	static constexpr bool has_equal() {
+		return Detect_V<Has_Equal_Operator, Allocator>;
+	}
 };
 
 } // namespace detail
@@ -104,6 +124,27 @@ class Allocator_Traits : detail::Allocator_Traits_Base
 		return Allocator();
 	}
 
+	/**
+	 * @brief Returns true if memory allocated by either allocator can be
+	 * deallocated by the other. Allocators which do not provide an
+	 * equality operator are only equal to themselves, unless they hold no
+	 * state
+	 */
+	static constexpr bool equal(Allocator const &lhs, Allocator const &rhs) {
+		if constexpr (has_equal<Allocator>())
+		{
+			return lhs == rhs;
+		}
+		else if constexpr (std::is_empty_v<Allocator>)
+		{
+			return true;
+		}
+		else
+		{
+			return std::addressof(lhs) == std::addressof(rhs);
+		}
+	}
+
 	static constexpr Pointer allocate(Allocator &allocator, std::size_t count) {
 		if constexpr (has_allocate<Allocator>())
 		{
@@ -164,6 +205,38 @@ class Allocator_Traits : detail::Allocator_Traits_Base
 		}
 	}
 
+	/**
+	 * @brief Tries to grow the allocation at pointer from count to
+	 * new_count elements without moving it. Returns false, leaving the
+	 * allocation untouched, if the allocator does not provide an
+	 * expand_in_place operation or if it could not satisfy the request.
+	 * On success the allocation must be deallocated with new_count.
+	 */
+	template<typename Pointer_t>
+	static constexpr bool expand_in_place(
+	    // MSVC gives unused error if both branches are not used
+	    [[maybe_unused]] Allocator  &allocator,
+	    [[maybe_unused]] Pointer_t &&pointer,
+	    [[maybe_unused]] std::size_t count,
+	    [[maybe_unused]] std::size_t new_count) {
+		static_assert(
+		    std::is_same_v<Pointer, std::remove_cvref_t<Pointer_t>>,
+		    "These traits should not be passed a different pointer "
+		    "type");
+
+		if constexpr (has_expand_in_place<Allocator, Pointer>())
+		{
+			return allocator.expand_in_place(
+			    std::forward<Pointer_t>(pointer),
+			    count,
+			    new_count);
+		}
+		else
+		{
+			return false;
+		}
+	}
+
 	template<typename Pointer_t>
 	static constexpr void destroy(
 	    // MSVC gives unused error if both branches are not used
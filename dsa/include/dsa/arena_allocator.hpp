@@ -0,0 +1,73 @@
+#ifndef DSA_ARENA_ALLOCATOR_HPP
+#define DSA_ARENA_ALLOCATOR_HPP
+
+#include <dsa/default_allocator.hpp>
+#include <dsa/monotonic_buffer.hpp>
+
+#include <cstddef>
+
+namespace dsa
+{
+
+/**
+ * @brief Allocates elements from a Monotonic_Buffer which must outlive the
+ * allocator and every container using it. Deallocation only gives memory back
+ * when it releases the most recent allocation, otherwise the memory is kept
+ * until the buffer is reset.
+ *
+ * @tparam Value_t: The type of element to allocate
+ * @tparam Upstream_Allocator_t: The upstream allocator of the buffer
+ */
+template<typename Value_t, typename Upstream_Allocator_t = Default_Allocator<std::byte>>
+class Arena_Allocator
+{
+ public:
+	template<typename T>
+	using rebind = Arena_Allocator<T, Upstream_Allocator_t>;
+
+	using Value  = Value_t;
+	using Buffer = Monotonic_Buffer<Upstream_Allocator_t>;
+
+	explicit Arena_Allocator(Buffer &buffer) : m_buffer(&buffer) {
+	}
+
+	template<typename T>
+	explicit Arena_Allocator(Arena_Allocator<T, Upstream_Allocator_t> const &allocator)
+	    : m_buffer(&allocator.buffer()) {
+	}
+
+	[[nodiscard]] Buffer &buffer() const {
+		return *m_buffer;
+	}
+
+	[[nodiscard]] Value *allocate(std::size_t count) {
+		void *memory = m_buffer->allocate(count * sizeof(Value), alignof(Value));
+		return static_cast<Value *>(memory);
+	}
+
+	void deallocate(Value *pointer, std::size_t count) {
+		m_buffer->deallocate(pointer, count * sizeof(Value));
+	}
+
+	bool expand_in_place(Value *pointer, std::size_t count, std::size_t new_count) {
+		return m_buffer->expand_in_place(
+		    pointer,
+		    count * sizeof(Value),
+		    new_count * sizeof(Value));
+	}
+
+	/**
+	 * @brief Allocators drawing from the same buffer can free each other's
+	 * memory
+	 */
+	friend bool operator==(Arena_Allocator const &lhs, Arena_Allocator const &rhs) noexcept {
+		return lhs.m_buffer == rhs.m_buffer;
+	}
+
+ private:
+	Buffer *m_buffer;
+};
+
+} // namespace dsa
+
+#endif
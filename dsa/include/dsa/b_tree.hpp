@@ -0,0 +1,956 @@
+#ifndef DSA_B_TREE_HPP
+#define DSA_B_TREE_HPP
+
+#include <dsa/allocator_traits.hpp>
+#include <dsa/default_allocator.hpp>
+#include <dsa/memory.hpp>
+#include <dsa/partition_point.hpp>
+#include <dsa/uninitialised_array.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace dsa
+{
+
+namespace detail
+{
+
+/**
+ * @brief Counts the first count keys which satisfy is_before, which must hold
+ * for a prefix of the keys. Nodes of up to linear_search_limit keys compare
+ * every key without branching, which compilers vectorise for arithmetic keys
+ * and which beats a binary search over a few cache lines. Larger nodes use
+ * the branchless partition_point.
+ */
+template<std::size_t Capacity, typename Key>
+std::size_t count_before(Key const *keys, std::size_t count, auto const &is_before) {
+	constexpr std::size_t linear_search_limit = 32;
+
+	if constexpr (Capacity <= linear_search_limit)
+	{
+		std::size_t before = 0;
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			before += static_cast<std::size_t>(is_before(keys[index]));
+		}
+		return before;
+	}
+	else
+	{
+		Key const *const found = partition_point(keys, keys + count, is_before);
+		return static_cast<std::size_t>(found - keys);
+	}
+}
+
+/// @brief Lets iterators which return their elements by value offer an arrow
+/// operator, by holding the element for as long as the expression needs it
+template<typename Reference>
+class Arrow_Proxy
+{
+ public:
+	explicit Arrow_Proxy(Reference reference) : m_reference(reference) {
+	}
+
+	Reference const *operator->() const {
+		return std::addressof(m_reference);
+	}
+
+ private:
+	Reference m_reference;
+};
+
+} // namespace detail
+
+/**
+ * @brief Maps unique keys to values in a B+ tree, whose nodes are sized to
+ * Node_Bytes so that a node fills a few cache lines or a page. Each node
+ * holds its keys contiguously, so descending a level costs a cache miss or
+ * two and a search of the keys of a single node, instead of one cache miss
+ * for every key compared in a binary tree. Every value is kept in the leaves,
+ * which are linked in key order so that iterating or scanning a range never
+ * climbs back up the tree, and the inner nodes only hold copies of keys which
+ * separate their children.
+ *
+ * Nodes split when full and borrow from or merge with a sibling when less
+ * than half full, so every leaf is at the same depth and insert, find and
+ * erase take O(log n) time. Inserting or erasing moves the other elements of
+ * the node, which invalidates iterators to the node.
+ *
+ * The allocator is rebound to the leaf and inner nodes and must hand out raw
+ * pointers.
+ *
+ * @ingroup containers
+ *
+ * @tparam Key_t: The type of key, which must be copyable
+ * @tparam Mapped_t: The type of value associated to each key
+ * @tparam Node_Bytes: The approximate size of a node in bytes
+ * @tparam Compare_t: Orders the keys
+ * @tparam Allocator_t: The type of allocator used for memory management
+ */
+template<
+    typename Key_t,
+    typename Mapped_t,
+    std::size_t Node_Bytes = 256,
+    typename Compare_t     = std::less<Key_t>,
+    typename Allocator_t   = Default_Allocator<std::pair<Key_t, Mapped_t>>>
+class B_Tree
+{
+ private:
+	static constexpr std::size_t minimum_capacity = 4;
+
+	/// @brief Returns how many elements of the given size fit in a node
+	/// besides the given overhead, and at least enough to split a node
+	static constexpr std::size_t capacity_for(std::size_t overhead, std::size_t element_bytes) {
+		std::size_t const usable = Node_Bytes > overhead ? Node_Bytes - overhead : 0;
+		return std::max(minimum_capacity, usable / element_bytes);
+	}
+
+	static constexpr std::size_t leaf_capacity = capacity_for(
+	    sizeof(std::size_t) + sizeof(void *),
+	    sizeof(Key_t) + sizeof(Mapped_t));
+	static constexpr std::size_t internal_capacity =
+	    capacity_for(sizeof(std::size_t) + sizeof(void *), sizeof(Key_t) + sizeof(void *));
+
+	struct Node
+	{
+		std::size_t m_count = 0;
+	};
+
+	struct Leaf : Node
+	{
+		Leaf() {
+		}
+
+		detail::Uninitialised_Array<Key_t, leaf_capacity>    m_keys;
+		detail::Uninitialised_Array<Mapped_t, leaf_capacity> m_values;
+		Leaf                                                *m_next = nullptr;
+	};
+
+	// The key at index i separates the child at index i, whose keys are all
+	// ordered before it, from the child at index i + 1
+	struct Internal : Node
+	{
+		Internal() {
+		}
+
+		detail::Uninitialised_Array<Key_t, internal_capacity> m_keys;
+		std::array<Node *, internal_capacity + 1>             m_children;
+	};
+
+	using Leaf_Traits     = Allocator_Traits<typename Allocator_t::template rebind<Leaf>>;
+	using Internal_Traits = Allocator_Traits<typename Allocator_t::template rebind<Internal>>;
+
+	static_assert(
+	    std::is_same_v<typename Leaf_Traits::Pointer, Leaf *>
+		&& std::is_same_v<typename Internal_Traits::Pointer, Internal *>,
+	    "The nodes link to each other with raw pointers");
+
+	template<bool Is_Const>
+	class Iterator_Detail
+	{
+	 private:
+		using Leaf_Pointer = std::conditional_t<Is_Const, Leaf const *, Leaf *>;
+		using Mapped_Reference =
+		    std::conditional_t<Is_Const, Mapped_t const &, Mapped_t &>;
+
+	 public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = std::pair<Key_t, Mapped_t>;
+		using reference         = std::pair<Key_t const &, Mapped_Reference>;
+		using pointer           = detail::Arrow_Proxy<reference>;
+
+		Iterator_Detail() = default;
+
+		Iterator_Detail(Leaf_Pointer leaf, std::size_t index)
+		    : m_leaf(leaf)
+		    , m_index(index) {
+		}
+
+		/// @brief Allows converting an Iterator into a Const_Iterator
+		operator Iterator_Detail<true>() const
+		    requires(!Is_Const)
+		{
+			return {m_leaf, m_index};
+		}
+
+		Iterator_Detail &operator++() {
+			if (++m_index == m_leaf->m_count)
+			{
+				m_leaf  = m_leaf->m_next;
+				m_index = 0;
+			}
+			return *this;
+		}
+
+		Iterator_Detail operator++(int) {
+			Iterator_Detail iterator = *this;
+			++*this;
+			return iterator;
+		}
+
+		bool operator==(Iterator_Detail const &iterator) const = default;
+
+		reference operator*() const {
+			return {m_leaf->m_keys[m_index], m_leaf->m_values[m_index]};
+		}
+
+		pointer operator->() const {
+			return pointer(**this);
+		}
+
+	 private:
+		friend B_Tree;
+
+		Leaf_Pointer m_leaf  = nullptr;
+		std::size_t  m_index = 0;
+	};
+
+	/// @brief The element an insertion found or constructed, and the new
+	/// sibling of the node it went through if that node had to split
+	struct Insertion
+	{
+		Iterator_Detail<false> m_position;
+		bool                   m_inserted = false;
+		std::optional<Key_t>   m_separator;
+		Node                  *m_right = nullptr;
+	};
+
+ public:
+	using Allocator      = Allocator_t;
+	using Iterator       = Iterator_Detail<false>;
+	using Const_Iterator = Iterator_Detail<true>;
+	using Key            = Key_t;
+	using Mapped         = Mapped_t;
+	using Compare        = Compare_t;
+
+	/**
+	 * @brief Constructs an empty tree, which allocates no nodes until the
+	 * first insertion
+	 */
+	explicit B_Tree(Allocator const &allocator = Allocator())
+	    : m_leaf_allocator(allocator)
+	    , m_internal_allocator(allocator) {
+	}
+
+	~B_Tree() {
+		clear();
+	}
+
+	B_Tree(B_Tree const &tree)
+	    : m_compare(tree.m_compare)
+	    , m_leaf_allocator(Leaf_Traits::propogate_or_create_instance(tree.m_leaf_allocator))
+	    , m_internal_allocator(
+		  Internal_Traits::propogate_or_create_instance(tree.m_internal_allocator))
+	    , m_size(tree.m_size)
+	    , m_height(tree.m_height) {
+		if (tree.m_root != nullptr)
+		{
+			Leaf *previous = nullptr;
+			m_root         = copy_subtree(tree.m_root, m_height - 1, previous);
+		}
+	}
+
+	B_Tree &operator=(B_Tree const &tree) {
+		B_Tree copy(tree);
+		swap(*this, copy);
+		return *this;
+	}
+
+	B_Tree(B_Tree &&tree) noexcept
+	    : m_compare(std::move(tree.m_compare))
+	    , m_leaf_allocator(std::move(tree.m_leaf_allocator))
+	    , m_internal_allocator(std::move(tree.m_internal_allocator))
+	    , m_root(std::exchange(tree.m_root, nullptr))
+	    , m_first(std::exchange(tree.m_first, nullptr))
+	    , m_size(std::exchange(tree.m_size, 0))
+	    , m_height(std::exchange(tree.m_height, 0)) {
+	}
+
+	B_Tree &operator=(B_Tree &&tree) noexcept {
+		swap(*this, tree);
+		return *this;
+	}
+
+	friend void swap(B_Tree &lhs, B_Tree &rhs) noexcept {
+		using std::swap;
+
+		swap(lhs.m_compare, rhs.m_compare);
+		swap(lhs.m_leaf_allocator, rhs.m_leaf_allocator);
+		swap(lhs.m_internal_allocator, rhs.m_internal_allocator);
+		swap(lhs.m_root, rhs.m_root);
+		swap(lhs.m_first, rhs.m_first);
+		swap(lhs.m_size, rhs.m_size);
+		swap(lhs.m_height, rhs.m_height);
+	}
+
+	[[nodiscard]] Iterator begin() {
+		return {m_first, 0};
+	}
+
+	[[nodiscard]] Const_Iterator begin() const {
+		return {m_first, 0};
+	}
+
+	[[nodiscard]] Iterator end() {
+		return {};
+	}
+
+	[[nodiscard]] Const_Iterator end() const {
+		return {};
+	}
+
+	[[nodiscard]] std::size_t size() const {
+		return m_size;
+	}
+
+	[[nodiscard]] bool empty() const {
+		return m_size == 0;
+	}
+
+	/**
+	 * @brief Returns the number of levels of nodes, which is zero for an
+	 * empty tree
+	 */
+	[[nodiscard]] std::size_t height() const {
+		return m_height;
+	}
+
+	/**
+	 * @brief Returns the most elements a leaf holds, which is derived from
+	 * Node_Bytes
+	 */
+	[[nodiscard]] static constexpr std::size_t node_capacity() {
+		return leaf_capacity;
+	}
+
+	void clear() {
+		if (m_root != nullptr)
+		{
+			delete_subtree(m_root, m_height - 1);
+		}
+		m_root   = nullptr;
+		m_first  = nullptr;
+		m_size   = 0;
+		m_height = 0;
+	}
+
+	/**
+	 * @brief Associates the key with a copy of the given value unless the
+	 * key is already present
+	 * @return The element with the key and whether it was inserted
+	 */
+	std::pair<Iterator, bool> insert(Key const &key, Mapped const &mapped) {
+		return try_emplace(key, mapped);
+	}
+
+	std::pair<Iterator, bool> insert(Key const &key, Mapped &&mapped) {
+		return try_emplace(key, std::move(mapped));
+	}
+
+	/**
+	 * @brief Associates the key with a value constructed from the given
+	 * arguments unless the key is already present, in which case nothing is
+	 * constructed
+	 * @return The element with the key and whether it was inserted
+	 */
+	template<typename... Arguments>
+	std::pair<Iterator, bool> try_emplace(Key const &key, Arguments &&...arguments) {
+		if (m_root == nullptr)
+		{
+			m_first  = create_leaf();
+			m_root   = m_first;
+			m_height = 1;
+		}
+
+		Insertion insertion =
+		    insert_into(m_root, m_height - 1, key, std::forward<Arguments>(arguments)...);
+		if (insertion.m_right != nullptr)
+		{
+			Internal *root      = create_internal();
+			root->m_children[0] = m_root;
+			add_child(root, 0, std::move(*insertion.m_separator), insertion.m_right);
+			m_root = root;
+			++m_height;
+		}
+
+		m_size += static_cast<std::size_t>(insertion.m_inserted);
+		return {insertion.m_position, insertion.m_inserted};
+	}
+
+	/**
+	 * @brief Returns the value associated with the key, inserting a default
+	 * constructed one if the key is not present
+	 */
+	Mapped &operator[](Key const &key) {
+		return try_emplace(key).first->second;
+	}
+
+	[[nodiscard]] Iterator find(Key const &key) {
+		Iterator const found = lower_bound(key);
+		return found != end() && !m_compare(key, found->first) ? found : end();
+	}
+
+	[[nodiscard]] Const_Iterator find(Key const &key) const {
+		Const_Iterator const found = lower_bound(key);
+		return found != end() && !m_compare(key, found->first) ? found : end();
+	}
+
+	[[nodiscard]] bool contains(Key const &key) const {
+		return find(key) != end();
+	}
+
+	/**
+	 * @brief Finds the first element whose key is not ordered before the
+	 * given key, from which the following elements can be scanned in order
+	 */
+	[[nodiscard]] Iterator lower_bound(Key const &key) {
+		return bound(key, [&](Key const &other) {
+			return m_compare(other, key);
+		});
+	}
+
+	[[nodiscard]] Const_Iterator lower_bound(Key const &key) const {
+		return bound(key, [&](Key const &other) {
+			return m_compare(other, key);
+		});
+	}
+
+	/**
+	 * @brief Finds the first element whose key is ordered after the given
+	 * key
+	 */
+	[[nodiscard]] Iterator upper_bound(Key const &key) {
+		return bound(key, [&](Key const &other) {
+			return !m_compare(key, other);
+		});
+	}
+
+	[[nodiscard]] Const_Iterator upper_bound(Key const &key) const {
+		return bound(key, [&](Key const &other) {
+			return !m_compare(key, other);
+		});
+	}
+
+	/**
+	 * @brief Removes the element with the given key
+	 * @return false if there was no such element
+	 */
+	bool erase(Key const &key) {
+		if (m_root == nullptr || !erase_from(m_root, m_height - 1, key))
+		{
+			return false;
+		}
+
+		--m_size;
+		shrink_root();
+		return true;
+	}
+
+	bool operator==(B_Tree const &tree) const {
+		return m_size == tree.m_size && std::equal(begin(), end(), tree.begin());
+	}
+
+	bool operator!=(B_Tree const &tree) const {
+		return !(*this == tree);
+	}
+
+ private:
+	using Leaf_Allocator     = typename Leaf_Traits::Allocator;
+	using Internal_Allocator = typename Internal_Traits::Allocator;
+
+	[[no_unique_address]] Compare m_compare;
+	Leaf_Allocator                m_leaf_allocator;
+	Internal_Allocator            m_internal_allocator;
+	Node                         *m_root   = nullptr;
+	Leaf                         *m_first  = nullptr;
+	std::size_t                   m_size   = 0;
+	std::size_t                   m_height = 0;
+
+	/// @brief The fewest elements a node below the root holds, a node with
+	/// fewer borrows from or merges with a sibling
+	static constexpr std::size_t minimum_count(std::size_t levels_below) {
+		return levels_below == 0 ? leaf_capacity / 2 : (internal_capacity - 1) / 2;
+	}
+
+	/// @brief Returns the index of the child whose keys may include the
+	/// given key
+	std::size_t child_index(Internal const *node, Key const &key) const {
+		return detail::count_before<internal_capacity>(
+		    node->m_keys.data(),
+		    node->m_count,
+		    [&](Key const &separator) {
+			    return !m_compare(key, separator);
+		    });
+	}
+
+	std::size_t key_index(Leaf const *leaf, Key const &key) const {
+		return detail::count_before<leaf_capacity>(
+		    leaf->m_keys.data(),
+		    leaf->m_count,
+		    [&](Key const &other) {
+			    return m_compare(other, key);
+		    });
+	}
+
+	Leaf *find_leaf(Key const &key) const {
+		Node *node = m_root;
+		for (std::size_t level = 1; level < m_height; ++level)
+		{
+			auto const *internal = static_cast<Internal const *>(node);
+			node                 = internal->m_children[child_index(internal, key)];
+		}
+		return static_cast<Leaf *>(node);
+	}
+
+	/// @brief Returns the first element which does not satisfy is_before,
+	/// which must hold for the elements ordered before the given key and may
+	/// hold for those equal to it
+	Iterator bound(Key const &key, auto const &is_before) const {
+		if (m_root == nullptr)
+		{
+			return {};
+		}
+
+		Leaf *const       leaf  = find_leaf(key);
+		std::size_t const index = detail::count_before<leaf_capacity>(
+		    leaf->m_keys.data(),
+		    leaf->m_count,
+		    is_before);
+		if (index == leaf->m_count)
+		{
+			return {leaf->m_next, 0};
+		}
+		return {leaf, index};
+	}
+
+	Leaf *create_leaf() {
+		Leaf *leaf = Leaf_Traits::allocate(m_leaf_allocator, 1);
+		Leaf_Traits::construct(m_leaf_allocator, leaf);
+		return leaf;
+	}
+
+	Internal *create_internal() {
+		Internal *node = Internal_Traits::allocate(m_internal_allocator, 1);
+		Internal_Traits::construct(m_internal_allocator, node);
+		return node;
+	}
+
+	void destroy_leaf(Leaf *leaf) {
+		std::destroy_n(leaf->m_keys.data(), leaf->m_count);
+		std::destroy_n(leaf->m_values.data(), leaf->m_count);
+		Leaf_Traits::destroy(m_leaf_allocator, leaf);
+		Leaf_Traits::deallocate(m_leaf_allocator, leaf, 1);
+	}
+
+	void destroy_internal(Internal *node) {
+		std::destroy_n(node->m_keys.data(), node->m_count);
+		Internal_Traits::destroy(m_internal_allocator, node);
+		Internal_Traits::deallocate(m_internal_allocator, node, 1);
+	}
+
+	void delete_subtree(Node *node, std::size_t levels_below) {
+		if (levels_below == 0)
+		{
+			destroy_leaf(static_cast<Leaf *>(node));
+			return;
+		}
+
+		auto *internal = static_cast<Internal *>(node);
+		for (std::size_t child = 0; child <= internal->m_count; ++child)
+		{
+			delete_subtree(internal->m_children[child], levels_below - 1);
+		}
+		destroy_internal(internal);
+	}
+
+	/// @brief Copies the subtree, linking its leaves after previous
+	Node *copy_subtree(Node const *node, std::size_t levels_below, Leaf *&previous) {
+		if (levels_below == 0)
+		{
+			auto const *leaf = static_cast<Leaf const *>(node);
+			Leaf       *copy = create_leaf();
+			std::uninitialized_copy_n(
+			    leaf->m_keys.data(),
+			    leaf->m_count,
+			    copy->m_keys.data());
+			std::uninitialized_copy_n(
+			    leaf->m_values.data(),
+			    leaf->m_count,
+			    copy->m_values.data());
+			copy->m_count = leaf->m_count;
+
+			(previous == nullptr ? m_first : previous->m_next) = copy;
+			previous                                           = copy;
+			return copy;
+		}
+
+		auto const *internal = static_cast<Internal const *>(node);
+		Internal   *copy     = create_internal();
+		std::uninitialized_copy_n(
+		    internal->m_keys.data(),
+		    internal->m_count,
+		    copy->m_keys.data());
+		for (std::size_t child = 0; child <= internal->m_count; ++child)
+		{
+			copy->m_children[child] =
+			    copy_subtree(internal->m_children[child], levels_below - 1, previous);
+		}
+		copy->m_count = internal->m_count;
+		return copy;
+	}
+
+	/// @brief Inserts the separator at index and the child after it
+	static void add_child(Internal *node, std::size_t index, Key &&separator, Node *child) {
+		detail::open_gap(node->m_keys.data(), node->m_count, index);
+		std::construct_at(node->m_keys.data() + index, std::move(separator));
+
+		Node **const children = node->m_children.data();
+		std::copy_backward(
+		    children + index + 1,
+		    children + node->m_count + 1,
+		    children + node->m_count + 2);
+		node->m_children[index + 1] = child;
+		++node->m_count;
+	}
+
+	template<typename... Arguments>
+	Insertion insert_into(
+	    Node        *node,
+	    std::size_t  levels_below,
+	    Key const   &key,
+	    Arguments &&...arguments) {
+		if (levels_below == 0)
+		{
+			return insert_into_leaf(
+			    static_cast<Leaf *>(node),
+			    key,
+			    std::forward<Arguments>(arguments)...);
+		}
+
+		auto *const       internal  = static_cast<Internal *>(node);
+		std::size_t const child     = child_index(internal, key);
+		Insertion         insertion = insert_into(
+		    internal->m_children[child],
+		    levels_below - 1,
+		    key,
+		    std::forward<Arguments>(arguments)...);
+		if (insertion.m_right == nullptr)
+		{
+			return insertion;
+		}
+
+		Key   separator = std::move(*insertion.m_separator);
+		Node *right     = std::exchange(insertion.m_right, nullptr);
+		insertion.m_separator.reset();
+		if (internal->m_count < internal_capacity)
+		{
+			add_child(internal, child, std::move(separator), right);
+			return insertion;
+		}
+
+		// The middle key moves up to the parent, the keys after it and the
+		// children they separate move to a new sibling
+		constexpr std::size_t half    = internal_capacity / 2;
+		Internal *const       sibling = create_internal();
+		insertion.m_separator.emplace(std::move(internal->m_keys[half]));
+		std::destroy_at(internal->m_keys.data() + half);
+		uninitialized_relocate(
+		    internal->m_keys.data() + half + 1,
+		    internal->m_keys.data() + internal_capacity,
+		    sibling->m_keys.data());
+		std::copy(
+		    internal->m_children.data() + half + 1,
+		    internal->m_children.data() + internal_capacity + 1,
+		    sibling->m_children.data());
+		sibling->m_count  = internal_capacity - half - 1;
+		internal->m_count = half;
+		insertion.m_right = sibling;
+
+		if (child <= half)
+		{
+			add_child(internal, child, std::move(separator), right);
+		}
+		else
+		{
+			add_child(sibling, child - half - 1, std::move(separator), right);
+		}
+		return insertion;
+	}
+
+	template<typename... Arguments>
+	Insertion insert_into_leaf(Leaf *leaf, Key const &key, Arguments &&...arguments) {
+		std::size_t const index = key_index(leaf, key);
+		if (index < leaf->m_count && !m_compare(key, leaf->m_keys[index]))
+		{
+			return {Iterator(leaf, index), false, std::nullopt, nullptr};
+		}
+
+		if (leaf->m_count < leaf_capacity)
+		{
+			emplace_in_leaf(leaf, index, key, std::forward<Arguments>(arguments)...);
+			return {Iterator(leaf, index), true, std::nullopt, nullptr};
+		}
+
+		// The upper half of the elements moves to a new sibling which
+		// follows the leaf
+		constexpr std::size_t half    = leaf_capacity / 2;
+		Leaf *const           sibling = create_leaf();
+		uninitialized_relocate(
+		    leaf->m_keys.data() + half,
+		    leaf->m_keys.data() + leaf_capacity,
+		    sibling->m_keys.data());
+		uninitialized_relocate(
+		    leaf->m_values.data() + half,
+		    leaf->m_values.data() + leaf_capacity,
+		    sibling->m_values.data());
+		sibling->m_count = leaf_capacity - half;
+		leaf->m_count    = half;
+		sibling->m_next  = leaf->m_next;
+		leaf->m_next     = sibling;
+
+		Iterator position;
+		if (index <= half)
+		{
+			emplace_in_leaf(leaf, index, key, std::forward<Arguments>(arguments)...);
+			position = Iterator(leaf, index);
+		}
+		else
+		{
+			emplace_in_leaf(
+			    sibling,
+			    index - half,
+			    key,
+			    std::forward<Arguments>(arguments)...);
+			position = Iterator(sibling, index - half);
+		}
+		return {position, true, sibling->m_keys[0], sibling};
+	}
+
+	template<typename... Arguments>
+	static void
+	emplace_in_leaf(Leaf *leaf, std::size_t index, Key const &key, Arguments &&...arguments) {
+		detail::open_gap(leaf->m_keys.data(), leaf->m_count, index);
+		detail::open_gap(leaf->m_values.data(), leaf->m_count, index);
+		std::construct_at(leaf->m_keys.data() + index, key);
+		std::construct_at(
+		    leaf->m_values.data() + index,
+		    std::forward<Arguments>(arguments)...);
+		++leaf->m_count;
+	}
+
+	/**
+	 * @brief Erases the key from the subtree, and refills the child it was
+	 * erased through if it was left with too few elements
+	 * @return false if the subtree does not hold the key
+	 */
+	bool erase_from(Node *node, std::size_t levels_below, Key const &key) {
+		if (levels_below == 0)
+		{
+			auto *const       leaf  = static_cast<Leaf *>(node);
+			std::size_t const index = key_index(leaf, key);
+			if (index == leaf->m_count || m_compare(key, leaf->m_keys[index]))
+			{
+				return false;
+			}
+
+			detail::close_gap(leaf->m_keys.data(), leaf->m_count, index);
+			detail::close_gap(leaf->m_values.data(), leaf->m_count, index);
+			--leaf->m_count;
+			return true;
+		}
+
+		auto *const       internal = static_cast<Internal *>(node);
+		std::size_t const child    = child_index(internal, key);
+		if (!erase_from(internal->m_children[child], levels_below - 1, key))
+		{
+			return false;
+		}
+
+		if (internal->m_children[child]->m_count < minimum_count(levels_below - 1))
+		{
+			rebalance(internal, child, levels_below - 1);
+		}
+		return true;
+	}
+
+	/// @brief Refills the child at index with an element of a sibling which
+	/// can spare one, or merges it with a sibling otherwise
+	void rebalance(Internal *parent, std::size_t index, std::size_t levels_below) {
+		std::size_t const minimum  = minimum_count(levels_below);
+		auto const       &children = parent->m_children;
+		if (index > 0 && children[index - 1]->m_count > minimum)
+		{
+			borrow_from_left(parent, index, levels_below);
+		}
+		else if (index < parent->m_count && children[index + 1]->m_count > minimum)
+		{
+			borrow_from_right(parent, index, levels_below);
+		}
+		else
+		{
+			merge(parent, index > 0 ? index - 1 : index, levels_below);
+		}
+	}
+
+	static void
+	borrow_from_left(Internal *parent, std::size_t index, std::size_t levels_below) {
+		Key &separator = parent->m_keys[index - 1];
+		if (levels_below == 0)
+		{
+			auto *const       leaf = static_cast<Leaf *>(parent->m_children[index]);
+			auto *const       left = static_cast<Leaf *>(parent->m_children[index - 1]);
+			std::size_t const last = --left->m_count;
+			detail::open_gap(leaf->m_keys.data(), leaf->m_count, 0);
+			detail::open_gap(leaf->m_values.data(), leaf->m_count, 0);
+			uninitialized_relocate(
+			    left->m_keys.data() + last,
+			    left->m_keys.data() + last + 1,
+			    leaf->m_keys.data());
+			uninitialized_relocate(
+			    left->m_values.data() + last,
+			    left->m_values.data() + last + 1,
+			    leaf->m_values.data());
+			++leaf->m_count;
+			separator = leaf->m_keys[0];
+			return;
+		}
+
+		// The separator moves down in front of the node and the last key of
+		// the left sibling replaces it
+		auto *const       node = static_cast<Internal *>(parent->m_children[index]);
+		auto *const       left = static_cast<Internal *>(parent->m_children[index - 1]);
+		std::size_t const last = --left->m_count;
+		detail::open_gap(node->m_keys.data(), node->m_count, 0);
+		std::construct_at(node->m_keys.data(), std::move(separator));
+		std::copy_backward(
+		    node->m_children.data(),
+		    node->m_children.data() + node->m_count + 1,
+		    node->m_children.data() + node->m_count + 2);
+		node->m_children[0] = left->m_children[last + 1];
+		++node->m_count;
+		separator = std::move(left->m_keys[last]);
+		std::destroy_at(left->m_keys.data() + last);
+	}
+
+	static void
+	borrow_from_right(Internal *parent, std::size_t index, std::size_t levels_below) {
+		Key &separator = parent->m_keys[index];
+		if (levels_below == 0)
+		{
+			auto *const leaf  = static_cast<Leaf *>(parent->m_children[index]);
+			auto *const right = static_cast<Leaf *>(parent->m_children[index + 1]);
+			std::construct_at(
+			    leaf->m_keys.data() + leaf->m_count,
+			    std::move(right->m_keys[0]));
+			std::construct_at(
+			    leaf->m_values.data() + leaf->m_count,
+			    std::move(right->m_values[0]));
+			++leaf->m_count;
+			detail::close_gap(right->m_keys.data(), right->m_count, 0);
+			detail::close_gap(right->m_values.data(), right->m_count, 0);
+			--right->m_count;
+			separator = right->m_keys[0];
+			return;
+		}
+
+		// The separator moves down behind the node and the first key of the
+		// right sibling replaces it
+		auto *const node  = static_cast<Internal *>(parent->m_children[index]);
+		auto *const right = static_cast<Internal *>(parent->m_children[index + 1]);
+		std::construct_at(node->m_keys.data() + node->m_count, std::move(separator));
+		node->m_children[node->m_count + 1] = right->m_children[0];
+		++node->m_count;
+		separator = std::move(right->m_keys[0]);
+		detail::close_gap(right->m_keys.data(), right->m_count, 0);
+		std::copy(
+		    right->m_children.data() + 1,
+		    right->m_children.data() + right->m_count + 1,
+		    right->m_children.data());
+		--right->m_count;
+	}
+
+	/// @brief Moves the elements of the child after index into the child at
+	/// index, and removes the emptied child and their separator
+	void merge(Internal *parent, std::size_t index, std::size_t levels_below) {
+		if (levels_below == 0)
+		{
+			auto *const leaf  = static_cast<Leaf *>(parent->m_children[index]);
+			auto *const right = static_cast<Leaf *>(parent->m_children[index + 1]);
+			uninitialized_relocate(
+			    right->m_keys.data(),
+			    right->m_keys.data() + right->m_count,
+			    leaf->m_keys.data() + leaf->m_count);
+			uninitialized_relocate(
+			    right->m_values.data(),
+			    right->m_values.data() + right->m_count,
+			    leaf->m_values.data() + leaf->m_count);
+			leaf->m_count += right->m_count;
+			leaf->m_next   = right->m_next;
+			right->m_count = 0;
+			destroy_leaf(right);
+		}
+		else
+		{
+			auto *const node  = static_cast<Internal *>(parent->m_children[index]);
+			auto *const right = static_cast<Internal *>(parent->m_children[index + 1]);
+			std::construct_at(
+			    node->m_keys.data() + node->m_count,
+			    std::move(parent->m_keys[index]));
+			uninitialized_relocate(
+			    right->m_keys.data(),
+			    right->m_keys.data() + right->m_count,
+			    node->m_keys.data() + node->m_count + 1);
+			std::copy(
+			    right->m_children.data(),
+			    right->m_children.data() + right->m_count + 1,
+			    node->m_children.data() + node->m_count + 1);
+			node->m_count += right->m_count + 1;
+			right->m_count = 0;
+			destroy_internal(right);
+		}
+
+		detail::close_gap(parent->m_keys.data(), parent->m_count, index);
+		std::copy(
+		    parent->m_children.data() + index + 2,
+		    parent->m_children.data() + parent->m_count + 1,
+		    parent->m_children.data() + index + 1);
+		--parent->m_count;
+	}
+
+	/// @brief Replaces a root without keys by its only child, or frees the
+	/// last leaf once it is empty
+	void shrink_root() {
+		if (m_root->m_count != 0)
+		{
+			return;
+		}
+
+		if (m_height == 1)
+		{
+			destroy_leaf(static_cast<Leaf *>(m_root));
+			m_root   = nullptr;
+			m_first  = nullptr;
+			m_height = 0;
+			return;
+		}
+
+		auto *const root = static_cast<Internal *>(m_root);
+		m_root           = root->m_children[0];
+		destroy_internal(root);
+		--m_height;
+	}
+};
+
+} // namespace dsa
+
+#endif
@@ -4,8 +4,12 @@
 #include <dsa/allocator_traits.hpp>
 #include <dsa/default_allocator.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstddef>
 #include <memory>
+#include <utility>
 
 namespace dsa
 {
@@ -60,10 +64,9 @@ class Binary_Tree_Node
 		explicit Iterator_Detail(Node_Pointer node) : m_node(node) {
 		}
 
-		Iterator_Detail operator++() {
-			m_node = next(m_node);
-			Iterator_Detail iterator(m_node);
-			return iterator;
+		Iterator_Detail &operator++() {
+			m_node = Binary_Tree_Node::next(m_node);
+			return *this;
 		}
 
 		bool operator==(Iterator_Detail const &iterator) const {
@@ -84,58 +87,65 @@ class Binary_Tree_Node
 
 	 private:
 		Node_Pointer m_node;
-
-		Node_Pointer next(Node_Pointer node) {
-			if (node == nullptr)
-			{
-				return nullptr;
-			}
-
-			if (node->m_right != nullptr)
-			{
-				node = node->m_right;
-				while (node->m_left != nullptr)
-				{
-					node = node->m_left;
-				}
-				return node;
-			}
-
-			if (node->m_parent == nullptr)
-			{
-				return nullptr;
-			}
-
-			if (node->m_parent->m_left == node)
-			{
-				return node->m_parent;
-			}
-
-			while (node->m_parent != nullptr && node->m_parent->m_right == node)
-			{
-				node = node->m_parent;
-			}
-			return node->m_parent;
-		}
 	};
 
  public:
 	using Iterator       = Iterator_Detail<false>;
 	using Const_Iterator = Iterator_Detail<true>;
 
-	Pointer   m_parent;
-	Pointer   m_left;
-	Pointer   m_right;
-	Satellite m_satellite;
+	Pointer     m_parent;
+	Pointer     m_left;
+	Pointer     m_right;
+	std::size_t m_subtree_size;
+	Satellite   m_satellite;
 
 	template<typename... Arguments>
 	explicit Binary_Tree_Node(Arguments &&...arguments)
 	    : m_parent(nullptr)
 	    , m_left(nullptr)
 	    , m_right(nullptr)
+	    , m_subtree_size(1)
 	    , m_satellite(std::forward<Arguments>(arguments)...) {
 	}
 
+	/// @brief Returns the leftmost node of the subtree, which holds its
+	/// smallest element
+	template<typename Node_Pointer>
+	static Node_Pointer leftmost(Node_Pointer node) {
+		while (node->m_left != nullptr)
+		{
+			node = node->m_left;
+		}
+		return node;
+	}
+
+	/**
+	 * @brief Returns the node after the given one in sorted order, or null
+	 * if it is the last. Over a full scan every edge is crossed once down
+	 * and once up, so an increment is amortised constant.
+	 *
+	 * The iterators climb the parent links rather than holding a stack of
+	 * the path: the height of the tree is not bounded, so the stack would
+	 * either allocate or be dropped and climbed anyway, and it would be
+	 * copied with every iterator. Full scans which should not climb use
+	 * Binary_Tree::for_each_in_order, whose stack lives for a single walk
+	 */
+	template<typename Node_Pointer>
+	static Node_Pointer next(Node_Pointer node) {
+		if (node->m_right != nullptr)
+		{
+			return leftmost(Node_Pointer(node->m_right));
+		}
+
+		Node_Pointer parent = node->m_parent;
+		while (parent != nullptr && parent->m_right == node)
+		{
+			node   = parent;
+			parent = parent->m_parent;
+		}
+		return parent;
+	}
+
 	friend auto operator<<(std::ostream &stream, Binary_Tree_Node const &node) -> std::ostream & {
 		return stream << '{' << node.m_left << ',' << node.m_parent << ',' << node.m_right
 			      << ',' << node.m_satellite << '}';
@@ -200,19 +210,24 @@ class Binary_Tree
 
 	Binary_Tree(Binary_Tree const &binary_tree)
 	    : m_allocator(binary_tree.m_allocator)
-	    , m_head(copy_subtree(nullptr, binary_tree.m_head)) {
+	    , m_head(copy_subtree(binary_tree.m_head))
+	    , m_first(m_head == nullptr ? nullptr : Node::leftmost(m_head))
+	    , m_size(binary_tree.m_size) {
 	}
 
 	Binary_Tree(Binary_Tree &&binary_tree) noexcept
-	    : m_allocator(binary_tree.m_allocator)
-	    , m_head(binary_tree.m_head) {
-		binary_tree.m_head = nullptr;
+	    : m_allocator(std::move(binary_tree.m_allocator))
+	    , m_head(std::exchange(binary_tree.m_head, nullptr))
+	    , m_first(std::exchange(binary_tree.m_first, nullptr))
+	    , m_size(std::exchange(binary_tree.m_size, 0)) {
 	}
 
 	friend void swap(Binary_Tree &lhs, Binary_Tree &rhs) {
 		using std::swap;
 		swap(lhs.m_allocator, rhs.m_allocator);
 		swap(lhs.m_head, rhs.m_head);
+		swap(lhs.m_first, rhs.m_first);
+		swap(lhs.m_size, rhs.m_size);
 	}
 
 	Binary_Tree &operator=(Binary_Tree binary_tree) noexcept {
@@ -228,21 +243,11 @@ class Binary_Tree
 	}
 
 	[[nodiscard]] Iterator begin() {
-		Node_Pointer node = m_head;
-		while (node != nullptr && node->m_left != nullptr)
-		{
-			node = node->m_left;
-		}
-		return Iterator(node);
+		return Iterator(m_first);
 	}
 
 	[[nodiscard]] Const_Iterator begin() const {
-		Node_Pointer node = m_head;
-		while (node != nullptr && node->m_left != nullptr)
-		{
-			node = node->m_left;
-		}
-		return Const_Iterator(node);
+		return Const_Iterator(m_first);
 	}
 
 	[[nodiscard]] Iterator end() {
@@ -254,19 +259,20 @@ class Binary_Tree
 	}
 
 	/**
-	 * @brief Gets the number of elements currently in the binary tree.
-	 * Note: This operation is not constant as the size is not cached
+	 * @brief Gets the number of elements currently in the binary tree
 	 */
 	[[nodiscard]] std::size_t size() const {
-		return count_nodes(m_head);
+		return m_size;
 	}
 
 	/**
 	 * @brief Clears all elements from the binary tree
 	 */
 	void clear() {
-		delete_node(m_head);
-		m_head = nullptr;
+		delete_subtree(m_head);
+		m_head  = nullptr;
+		m_first = nullptr;
+		m_size  = 0;
 	}
 
 	/**
@@ -289,20 +295,39 @@ class Binary_Tree
 	 * @brief Adds the given element into the binary tree
 	 */
 	void insert(Value_t value) {
-		Node_Pointer insert = create_node(std::move(value));
+		emplace(std::move(value));
+	}
+
+	/**
+	 * @brief Constructs an element from the given arguments, directly
+	 * inside of its node, and adds it into the binary tree
+	 * @return An iterator to the added element
+	 */
+	template<typename... Arguments>
+	Iterator emplace(Arguments &&...arguments) {
+		Node_Pointer insert = create_node(std::forward<Arguments>(arguments)...);
 
 		Node_Pointer  parent   = nullptr;
 		Node_Pointer *node_ptr = &m_head;
+		bool          smallest = true;
 		while (*node_ptr != nullptr)
 		{
 			parent             = *node_ptr;
 			Node_Pointer &node = *node_ptr;
-			node_ptr           = insert->m_satellite < node->m_satellite ? &node->m_left
-										     : &node->m_right;
+			++node->m_subtree_size;
+			bool const left = insert->m_satellite < node->m_satellite;
+			node_ptr        = left ? &node->m_left : &node->m_right;
+			smallest        = smallest && left;
 		}
 
 		*node_ptr        = insert;
 		insert->m_parent = parent;
+		if (smallest)
+		{
+			m_first = insert;
+		}
+		++m_size;
+		return Iterator(insert);
 	}
 
 	/**
@@ -323,25 +348,139 @@ class Binary_Tree
 			using std::swap;
 			Node_Pointer previous = extract_previous_node(node);
 			swap(node->m_satellite, previous->m_satellite);
-			delete_node(previous);
+			if (previous == m_first)
+			{
+				m_first = node;
+			}
+			shrink_ancestors(previous);
+			destroy_node(previous);
 		}
 		else if (node->m_right != nullptr)
 		{
+			if (node == m_first)
+			{
+				m_first = Node::leftmost(node->m_right);
+			}
 			*pointer             = node->m_right;
 			(*pointer)->m_parent = node->m_parent;
-
-			node->m_right = nullptr;
-			delete_node(node);
+			shrink_ancestors(node);
+			destroy_node(node);
 		}
 		else
 		{
+			if (node == m_first)
+			{
+				m_first = node->m_parent;
+			}
 			*pointer = nullptr;
-			delete_node(node);
+			shrink_ancestors(node);
+			destroy_node(node);
+		}
+		--m_size;
+	}
+
+	/**
+	 * @brief Calls the callback with every element in sorted order. The walk
+	 * keeps the nodes it still has to visit on a fixed size stack, so unlike
+	 * the iterator it does not climb the parent links after every element.
+	 * Only when a path is deeper than the stack are the dropped ancestors
+	 * found again through the parent links. The tree is not written to, so
+	 * the callback may read the tree while it is visited
+	 */
+	template<typename Callback>
+	void for_each_in_order(Callback &&callback) {
+		visit_in_order<Node_Pointer>(m_head, callback);
+	}
+
+	template<typename Callback>
+	void for_each_in_order(Callback &&callback) const {
+		visit_in_order<Node_Const_Pointer>(m_head, callback);
+	}
+
+	/**
+	 * @brief Finds the element at the given position in sorted order
+	 * @return An iterator to the element, or end if index is not less than
+	 * the size
+	 */
+	[[nodiscard]] Iterator select(std::size_t index) {
+		return Iterator(select_node(index));
+	}
+
+	[[nodiscard]] Const_Iterator select(std::size_t index) const {
+		return Const_Iterator(select_node(index));
+	}
+
+	/**
+	 * @brief Gets the number of elements which are less than the given one
+	 */
+	[[nodiscard]] std::size_t rank(Value_t const &value) const {
+		std::size_t        rank = 0;
+		Node_Const_Pointer node = m_head;
+		while (node != nullptr)
+		{
+			if (node->m_satellite < value)
+			{
+				rank += subtree_size(node->m_left) + 1;
+				node = node->m_right;
+			}
+			else
+			{
+				node = node->m_left;
+			}
+		}
+		return rank;
+	}
+
+	/**
+	 * @brief Gets the number of elements which are not less than lower and
+	 * are less than upper
+	 */
+	[[nodiscard]] std::size_t count_range(Value_t const &lower, Value_t const &upper) const {
+		if (!(lower < upper))
+		{
+			return 0;
 		}
+		return rank(upper) - rank(lower);
+	}
+
+	/**
+	 * @brief Finds the first element which is not less than the given one
+	 * @return An iterator to the element or end if there is none
+	 */
+	[[nodiscard]] Iterator lower_bound(Value_t const &value) {
+		return Iterator(bound_node(value, [](auto const &lhs, auto const &rhs) {
+			return lhs < rhs;
+		}));
+	}
+
+	[[nodiscard]] Const_Iterator lower_bound(Value_t const &value) const {
+		return Const_Iterator(bound_node(value, [](auto const &lhs, auto const &rhs) {
+			return lhs < rhs;
+		}));
+	}
+
+	/**
+	 * @brief Finds the first element which is greater than the given one
+	 * @return An iterator to the element or end if there is none
+	 */
+	[[nodiscard]] Iterator upper_bound(Value_t const &value) {
+		return Iterator(bound_node(value, [](auto const &lhs, auto const &rhs) {
+			return !(rhs < lhs);
+		}));
+	}
+
+	[[nodiscard]] Const_Iterator upper_bound(Value_t const &value) const {
+		return Const_Iterator(bound_node(value, [](auto const &lhs, auto const &rhs) {
+			return !(rhs < lhs);
+		}));
 	}
 
+	/**
+	 * @brief Returns true if both trees hold the same elements, which are
+	 * compared in order in a single pass over each tree
+	 */
 	friend bool operator==(Binary_Tree const &lhs, Binary_Tree const &rhs) noexcept {
-		return lhs.size() == rhs.size() && is_subset(lhs.m_head, rhs);
+		return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
 	}
 
 	friend bool operator!=(Binary_Tree const &lhs, Binary_Tree const &rhs) noexcept {
@@ -359,21 +498,107 @@ class Binary_Tree
  private:
 	Node_Allocator m_allocator;
 
-	Node_Pointer m_head = nullptr;
+	Node_Pointer m_head  = nullptr;
+	Node_Pointer m_first = nullptr;
+	std::size_t  m_size  = 0;
+
+	/// @brief The number of nodes for_each_in_order keeps on its stack, which
+	/// covers the height of any tree which is not badly unbalanced
+	static constexpr std::size_t visit_stack_size = 64;
 
-	std::size_t count_nodes(Node_Const_Pointer node) const {
-		if (node == nullptr)
+	template<typename Pointer>
+	static void visit_in_order(Pointer node, auto &&callback) {
+		// The stack is a ring, so when it is full the oldest ancestor is
+		// overwritten, and found again by climbing once the stack is empty
+		std::array<Pointer, visit_stack_size> stack{};
+		std::size_t                           top   = 0;
+		std::size_t                           count = 0;
+
+		Pointer last = nullptr;
+		while (true)
 		{
-			return 0;
+			for (; node != nullptr; node = node->m_left)
+			{
+				stack[top] = node;
+				top        = (top + 1) % visit_stack_size;
+				count      = std::min(count + 1, visit_stack_size);
+			}
+
+			if (count > 0)
+			{
+				top  = (top + visit_stack_size - 1) % visit_stack_size;
+				node = stack[top];
+				--count;
+			}
+			else
+			{
+				node = last == nullptr ? nullptr : Node::next(last);
+			}
+
+			if (node == nullptr)
+			{
+				return;
+			}
+
+			callback(node->m_satellite);
+			last = node;
+			node = node->m_right;
+		}
+	}
+
+	[[nodiscard]] static std::size_t subtree_size(Node_Const_Pointer node) {
+		return node == nullptr ? 0 : node->m_subtree_size;
+	}
+
+	/// @brief Removes the given node from the subtree sizes of its ancestors
+	static void shrink_ancestors(Node_Pointer node) {
+		for (Node_Pointer parent = node->m_parent; parent != nullptr; parent = parent->m_parent)
+		{
+			--parent->m_subtree_size;
+		}
+	}
+
+	[[nodiscard]] Node_Pointer select_node(std::size_t index) const {
+		Node_Pointer node = m_head;
+		while (node != nullptr)
+		{
+			std::size_t const left = subtree_size(node->m_left);
+			if (index == left)
+			{
+				return node;
+			}
+
+			if (index < left)
+			{
+				node = node->m_left;
+			}
+			else
+			{
+				index -= left + 1;
+				node = node->m_right;
+			}
 		}
-		return 1 + count_nodes(node->m_left) + count_nodes(node->m_right);
+		return nullptr;
 	}
 
-	[[nodiscard]] static bool is_subset(Node_Pointer node, Binary_Tree const &binary_tree) {
-		return (node == nullptr)
-		       || (binary_tree.contains(node->m_satellite)
-			   && is_subset(node->m_left, binary_tree)
-			   && is_subset(node->m_right, binary_tree));
+	/// @brief Returns the first node whose element does not satisfy
+	/// is_before, which holds for the elements ordered before the bound
+	[[nodiscard]] Node_Pointer bound_node(Value_t const &value, auto const &is_before) const {
+		Node_Pointer bound = nullptr;
+		Node_Pointer node  = m_head;
+		while (node != nullptr)
+		{
+			if (is_before(node->m_satellite, value))
+			{
+				node = node->m_right;
+			}
+			else
+			{
+				bound = node;
+				node  = node->m_left;
+			}
+		}
+		return bound;
 	}
 
 	[[nodiscard]] static bool compare_structure(Node_Pointer lhs, Node_Pointer rhs) {
@@ -383,17 +608,50 @@ class Binary_Tree
 			   && compare_structure(lhs->m_right, rhs->m_right));
 	}
 
-	[[nodiscard]] Node_Pointer copy_subtree(Node_Pointer parent, Node_Pointer subtree) {
+	/**
+	 * @brief Copies the subtree without recursing, so that degenerate trees
+	 * do not overflow the stack. The source is walked through its parent
+	 * pointers, and a child is copied the first time the walk reaches it
+	 */
+	[[nodiscard]] Node_Pointer copy_subtree(Node_Pointer subtree) {
 		if (subtree == nullptr)
 		{
 			return nullptr;
 		}
 
-		Node_Pointer root = create_node(subtree->m_satellite);
-		root->m_parent    = parent;
-		root->m_left      = copy_subtree(root, subtree->m_left);
-		root->m_right     = copy_subtree(root, subtree->m_right);
-		return root;
+		Node_Pointer root    = create_node(subtree->m_satellite);
+		root->m_subtree_size = subtree->m_subtree_size;
+
+		Node_Pointer from = subtree;
+		Node_Pointer to   = root;
+		while (true)
+		{
+			if (from->m_left != nullptr && to->m_left == nullptr)
+			{
+				to->m_left                 = create_node(from->m_left->m_satellite);
+				to->m_left->m_parent       = to;
+				to->m_left->m_subtree_size = from->m_left->m_subtree_size;
+				from                       = from->m_left;
+				to                         = to->m_left;
+			}
+			else if (from->m_right != nullptr && to->m_right == nullptr)
+			{
+				to->m_right                 = create_node(from->m_right->m_satellite);
+				to->m_right->m_parent       = to;
+				to->m_right->m_subtree_size = from->m_right->m_subtree_size;
+				from                        = from->m_right;
+				to                          = to->m_right;
+			}
+			else if (to != root)
+			{
+				from = from->m_parent;
+				to   = to->m_parent;
+			}
+			else
+			{
+				return root;
+			}
+		}
 	}
 
 	template<typename... Arguments>
@@ -408,16 +666,27 @@ class Binary_Tree
 		Node_Traits::deallocate(m_allocator, node, 1);
 	}
 
-	void delete_node(Node_Pointer node) {
-		if (node == nullptr)
+	/**
+	 * @brief Destroys the subtree without recursing, by rotating left
+	 * children up until the node at the top has none and can be destroyed
+	 */
+	void delete_subtree(Node_Pointer node) {
+		while (node != nullptr)
 		{
-			return;
+			if (node->m_left != nullptr)
+			{
+				Node_Pointer left = node->m_left;
+				node->m_left      = left->m_right;
+				left->m_right     = node;
+				node              = left;
+			}
+			else
+			{
+				Node_Pointer right = node->m_right;
+				destroy_node(node);
+				node = right;
+			}
 		}
-
-		delete_node(node->m_left);
-		delete_node(node->m_right);
-
-		destroy_node(node);
 	}
 
 	Node_Pointer extract_previous_node(Node_Pointer node) {
@@ -427,6 +696,10 @@ class Binary_Tree
 			Node_Pointer result = node->m_left;
 			node->m_left        = result->m_left;
 			result->m_left      = nullptr;
+			if (node->m_left != nullptr)
+			{
+				node->m_left->m_parent = node;
+			}
 			return result;
 		}
 
@@ -439,6 +712,10 @@ class Binary_Tree
 		Node_Pointer result = parent->m_right;
 		parent->m_right     = result->m_left;
 		result->m_left      = nullptr;
+		if (parent->m_right != nullptr)
+		{
+			parent->m_right->m_parent = parent;
+		}
 		return result;
 	}
 };
@@ -0,0 +1,213 @@
+#ifndef DSA_BOUNDED_QUEUE_HPP
+#define DSA_BOUNDED_QUEUE_HPP
+
+#include <dsa/default_allocator.hpp>
+#include <dsa/dynamic_array.hpp>
+#include <dsa/memory.hpp>
+#include <dsa/uninitialised_array.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace dsa
+{
+
+/**
+ * @brief A first in first out queue of fixed capacity which any number of
+ * threads can push to and pop from at once without taking a lock.
+ *
+ * The elements are kept in a ring of slots, each stamped with a sequence
+ * number which tells whether it is ready to be written or read for the
+ * current lap around the ring, as described by Dmitry Vyukov. A push or pop
+ * claims its position with a single compare and swap and then only touches
+ * its own slot, so producers and consumers only contend with each other on
+ * the slot they share. The push and pop positions sit on separate cache
+ * lines.
+ *
+ * The ring is held in a Dynamic_Array, whose allocator is rebound to the
+ * slots.
+ *
+ * @ingroup containers
+ *
+ * @tparam Value_t: The type of element to store, whose move constructor
+ * should not throw
+ * @tparam Allocator_t: The type of allocator used for memory management
+ */
+template<typename Value_t, typename Allocator_t = Default_Allocator<Value_t>>
+class Bounded_Queue
+{
+ private:
+	/**
+	 * @brief Holds one element of the ring, which may be written when the
+	 * sequence equals the position being pushed and read when it is one past
+	 * the position being popped
+	 */
+	struct Slot
+	{
+		Slot() = default;
+
+		// The ring is filled with copies of an empty slot, so copies only
+		// take the sequence
+		Slot(Slot const &slot)
+		    : m_sequence(slot.m_sequence.load(std::memory_order_relaxed)) {
+		}
+
+		Slot &operator=(Slot const &) = delete;
+
+		std::atomic<std::size_t>                m_sequence = 0;
+		detail::Uninitialised_Array<Value_t, 1> m_value;
+	};
+
+	using Slot_Allocator = typename Allocator_t::template rebind<Slot>;
+
+ public:
+	using Allocator = Allocator_t;
+	using Value     = Value_t;
+
+	/**
+	 * @brief Constructs an empty queue which holds at least the given number
+	 * of elements, rounded up to a power of two
+	 */
+	explicit Bounded_Queue(std::size_t capacity, Allocator const &allocator = Allocator())
+	    : m_slots(
+		  std::bit_ceil(std::max<std::size_t>(capacity, 2)),
+		  Slot(),
+		  Slot_Allocator(allocator))
+	    , m_mask(m_slots.size() - 1) {
+		for (std::size_t position = 0; position < m_slots.size(); ++position)
+		{
+			m_slots[position].m_sequence.store(position, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * @brief Destroys the elements which are still queued. No other thread
+	 * may use the queue any more
+	 */
+	~Bounded_Queue() {
+		while (try_pop())
+		{
+		}
+	}
+
+	Bounded_Queue(Bounded_Queue const &)            = delete;
+	Bounded_Queue &operator=(Bounded_Queue const &) = delete;
+	Bounded_Queue(Bounded_Queue &&)                 = delete;
+	Bounded_Queue &operator=(Bounded_Queue &&)      = delete;
+
+	/**
+	 * @brief Returns the number of elements the queue holds when full
+	 */
+	[[nodiscard]] std::size_t capacity() const {
+		return m_slots.size();
+	}
+
+	/**
+	 * @brief Moves the value to the back of the queue
+	 * @return false, leaving the value untouched, if the queue was full
+	 */
+	bool try_push(Value_t &&value) {
+		return push(value);
+	}
+
+	/**
+	 * @brief Copies the value to the back of the queue. The copy is made
+	 * before claiming a slot, so a copy which throws leaves the queue as it
+	 * was
+	 * @return false if the queue was full
+	 */
+	bool try_push(Value_t const &value) {
+		Value_t copy(value);
+		return push(copy);
+	}
+
+	/**
+	 * @brief Removes the element at the front of the queue
+	 * @return The element, or nothing if the queue was empty
+	 */
+	std::optional<Value_t> try_pop() {
+		std::size_t position = m_pop_position.load(std::memory_order_relaxed);
+		Slot       *slot     = nullptr;
+		while (true)
+		{
+			slot                = &m_slots[position & m_mask];
+			auto const sequence = slot->m_sequence.load(std::memory_order_acquire);
+			auto const lag      = static_cast<std::ptrdiff_t>(sequence - position - 1);
+			if (lag == 0)
+			{
+				if (m_pop_position.compare_exchange_weak(
+					position,
+					position + 1,
+					std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (lag < 0)
+			{
+				return std::nullopt;
+			}
+			else
+			{
+				position = m_pop_position.load(std::memory_order_relaxed);
+			}
+		}
+
+		Value_t               *element = slot->m_value.data();
+		std::optional<Value_t> value(std::move(*element));
+		std::destroy_at(element);
+		slot->m_sequence.store(position + m_mask + 1, std::memory_order_release);
+		return value;
+	}
+
+ private:
+	Dynamic_Array<Slot, Slot_Allocator> m_slots;
+	std::size_t                         m_mask;
+
+	alignas(detail::cache_line_size) std::atomic<std::size_t> m_push_position = 0;
+	alignas(detail::cache_line_size) std::atomic<std::size_t> m_pop_position  = 0;
+
+	/// @brief Claims the next slot and moves the value into it
+	bool push(Value_t &value) {
+		std::size_t position = m_push_position.load(std::memory_order_relaxed);
+		Slot       *slot     = nullptr;
+		while (true)
+		{
+			slot                = &m_slots[position & m_mask];
+			auto const sequence = slot->m_sequence.load(std::memory_order_acquire);
+			auto const lag      = static_cast<std::ptrdiff_t>(sequence - position);
+			if (lag == 0)
+			{
+				if (m_push_position.compare_exchange_weak(
+					position,
+					position + 1,
+					std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (lag < 0)
+			{
+				return false;
+			}
+			else
+			{
+				position = m_push_position.load(std::memory_order_relaxed);
+			}
+		}
+
+		std::construct_at(slot->m_value.data(), std::move(value));
+		slot->m_sequence.store(position + 1, std::memory_order_release);
+		return true;
+	}
+};
+
+} // namespace dsa
+
+#endif
@@ -69,7 +69,7 @@ class Dynamic_Array
 	    : m_allocator(std::move(allocator))
 	    , m_size(size)
 	    , m_storage(Alloc_Traits::allocate(m_allocator, size)) {
-		std::uninitialized_fill(begin(), end(), value);
+		std::uninitialized_fill_n(begin(), size, value);
 	}
 
 	/**
@@ -185,16 +185,25 @@ class Dynamic_Array
 	/**
 	 * Changes the size of the container. The first min(size, new_size)
 	 * elements are moved from the previous memory, the rest are initialised
-	 * to the given value
+	 * to the given value. When growing, the allocator is first given the
+	 * chance to extend the current allocation in place.
 	 */
 	constexpr void resize(std::size_t new_size, Value const &value = Value{}) {
 		using std::swap;
 
+		if (new_size > m_size && data() != nullptr
+		    && Alloc_Traits::expand_in_place(m_allocator, m_storage, m_size, new_size))
+		{
+			std::uninitialized_fill(end(), begin() + new_size, value);
+			m_size = new_size;
+			return;
+		}
+
 		const std::size_t count = std::min(m_size, new_size);
 
 		Pointer storage = Alloc_Traits::allocate(m_allocator, new_size);
 		std::uninitialized_fill(storage + count, storage + new_size, value);
-		uninitialized_move(begin(), begin() + count, storage);
+		uninitialized_relocate(begin(), begin() + count, storage);
 		std::destroy(begin() + count, end());
 		Alloc_Traits::deallocate(m_allocator, m_storage, m_size);
 
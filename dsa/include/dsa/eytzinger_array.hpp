@@ -0,0 +1,124 @@
+#ifndef DSA_EYTZINGER_ARRAY_HPP
+#define DSA_EYTZINGER_ARRAY_HPP
+
+#include <dsa/default_allocator.hpp>
+#include <dsa/dynamic_array.hpp>
+#include <dsa/partition_point.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace dsa
+{
+
+/**
+ * @brief Holds a sorted set of keys in the breadth first order of a complete
+ * binary search tree, where the children of the key at index i are at 2i and
+ * 2i + 1. The first levels of the tree share a few cache lines that stay hot
+ * across searches, and the keys a search visits next are known early enough to
+ * be prefetched, so searches on large arrays touch far fewer cache lines than
+ * a binary search on the sorted keys.
+ *
+ * @ingroup containers
+ *
+ * @tparam Value_t: The type of key to store
+ * @tparam Allocator_t: The type of allocator used for memory management
+ */
+template<typename Value_t, typename Allocator_t = Default_Allocator<Value_t>>
+class Eytzinger_Array
+{
+ public:
+	using Keys      = Dynamic_Array<Value_t, Allocator_t>;
+	using Allocator = typename Keys::Allocator;
+	using Value     = typename Keys::Value;
+
+	/**
+	 * @brief Lays out the given keys, which must be sorted in ascending order
+	 */
+	explicit Eytzinger_Array(Keys const &sorted)
+	    : m_keys(sorted.size() + 1, Value{}, sorted.allocator()) {
+		std::size_t next = 0;
+		fill(sorted, next, 1);
+	}
+
+	[[nodiscard]] std::size_t size() const {
+		return m_keys.size() - 1;
+	}
+
+	[[nodiscard]] bool empty() const {
+		return size() == 0;
+	}
+
+	/**
+	 * @brief Finds the smallest key which does not satisfy
+	 * comparator(key, value), the comparator must order the keys in the same
+	 * way as the one used to sort them
+	 * @return A pointer to the key, or nullptr if every key is ordered before
+	 * value
+	 */
+	template<typename Comparator = std::less<>>
+	[[nodiscard]] Value const *
+	lower_bound(Value const &value, Comparator const &comparator = {}) const {
+		std::size_t const  count = size();
+		Value const *const keys  = m_keys.data();
+
+		// Descending from i, the search reaches the index i * prefetch_stride
+		// four levels below, whose keys are contiguous and fill a cache line
+		// when the keys are four bytes
+		std::size_t index = 1;
+		while (index <= count)
+		{
+			detail::prefetch(keys + std::min(index * prefetch_stride, count));
+			bool const before = comparator(keys[index], value);
+			index             = 2 * index + static_cast<std::size_t>(before);
+		}
+
+		// The path ends with a right turn for every key ordered before value
+		// after the last key which is not, drop those and that left turn
+		index >>= std::countr_one(index) + 1;
+		return index == 0 ? nullptr : keys + index;
+	}
+
+	/**
+	 * @brief Finds the key equivalent to value under the given comparator,
+	 * which must order the keys in the same way as the one used to sort them
+	 * @return A pointer to the key, or nullptr if there is no such key
+	 */
+	template<typename Comparator = std::less<>>
+	[[nodiscard]] Value const *
+	find(Value const &value, Comparator const &comparator = {}) const {
+		Value const *const key = lower_bound(value, comparator);
+		return key != nullptr && !comparator(value, *key) ? key : nullptr;
+	}
+
+	template<typename Comparator = std::less<>>
+	[[nodiscard]] bool contains(Value const &value, Comparator const &comparator = {}) const {
+		return find(value, comparator) != nullptr;
+	}
+
+ private:
+	static constexpr std::size_t prefetch_stride = 16;
+
+	// Index 0 is unused so that the children of i are at 2i and 2i + 1
+	Keys m_keys;
+
+	/// @brief Writes the sorted keys into the subtree rooted at index with an
+	/// in order traversal, which visits the indices in ascending key order
+	void fill(Keys const &sorted, std::size_t &next, std::size_t index) {
+		if (index > sorted.size())
+		{
+			return;
+		}
+
+		fill(sorted, next, 2 * index);
+		m_keys[index] = sorted[next++];
+		fill(sorted, next, 2 * index + 1);
+	}
+};
+
+} // namespace dsa
+
+#endif
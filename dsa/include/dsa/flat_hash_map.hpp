@@ -0,0 +1,685 @@
+#ifndef DSA_FLAT_HASH_MAP_HPP
+#define DSA_FLAT_HASH_MAP_HPP
+
+#include <dsa/allocator_traits.hpp>
+#include <dsa/default_allocator.hpp>
+#include <dsa/dynamic_array.hpp>
+#include <dsa/hash.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64)
+	#define DSA_FLAT_HASH_MAP_SSE2
+	#include <emmintrin.h>
+#endif
+
+namespace dsa
+{
+
+namespace detail
+{
+
+/**
+ * @brief Hashes and key comparisons which accept any type comparable with the
+ * key, so that lookups do not have to construct a key
+ */
+template<typename Hash, typename Key_Equal>
+concept Transparent_Lookup = requires {
+	typename Hash::is_transparent;
+	typename Key_Equal::is_transparent;
+};
+
+/**
+ * @brief The control bytes of a group of consecutive slots, each of which is
+ * either empty or holds seven bits of the hash of the element in its slot.
+ * Queries return a mask with the bit of every matching byte set, and compare
+ * the whole group with a couple of instructions when SSE2 is available
+ */
+class Control_Group
+{
+ public:
+	static constexpr std::size_t  width = 16;
+	static constexpr std::uint8_t empty = 0x80;
+
+	explicit Control_Group(std::uint8_t const *control) {
+#ifdef DSA_FLAT_HASH_MAP_SSE2
+		m_bytes = _mm_loadu_si128(reinterpret_cast<__m128i const *>(control));
+#else
+		std::copy(control, control + width, m_bytes.begin());
+#endif
+	}
+
+	/// @brief Returns the slots which may hold an element with the given
+	/// seven bits of hash
+	[[nodiscard]] std::uint32_t match(std::uint8_t fingerprint) const {
+#ifdef DSA_FLAT_HASH_MAP_SSE2
+		__m128i const needle = _mm_set1_epi8(static_cast<char>(fingerprint));
+		__m128i const equal  = _mm_cmpeq_epi8(m_bytes, needle);
+		return static_cast<std::uint32_t>(_mm_movemask_epi8(equal));
+#else
+		std::uint32_t mask = 0;
+		for (std::size_t index = 0; index < width; ++index)
+		{
+			mask |= static_cast<std::uint32_t>(m_bytes[index] == fingerprint) << index;
+		}
+		return mask;
+#endif
+	}
+
+	/// @brief Returns the empty slots, which are the only ones whose control
+	/// byte has its high bit set
+	[[nodiscard]] std::uint32_t match_empty() const {
+#ifdef DSA_FLAT_HASH_MAP_SSE2
+		return static_cast<std::uint32_t>(_mm_movemask_epi8(m_bytes));
+#else
+		return match(empty);
+#endif
+	}
+
+ private:
+#ifdef DSA_FLAT_HASH_MAP_SSE2
+	__m128i m_bytes;
+#else
+	std::array<std::uint8_t, width> m_bytes;
+#endif
+};
+
+} // namespace detail
+
+/**
+ * @brief Maps unique keys to values in a flat array of slots split into groups
+ * of sixteen. A separate array holds a control byte for every slot with seven
+ * bits of the hash of its element, so a lookup compares the control bytes of a
+ * whole group at once and only compares keys for the few slots that match.
+ *
+ * The remaining bits of the hash select the home group of a key and
+ * insertions take the first group with an empty slot along a triangular probe
+ * sequence from there. Every group counts the elements which probed past it
+ * because it was full, so lookups stop at the first group with no such
+ * elements instead of at an empty slot. Erasing decrements the counts along
+ * the probe sequence and frees the slot, which leaves no tombstones behind to
+ * slow down later lookups. A count which saturates is never decremented again,
+ * which only makes some lookups probe further until the next rehash.
+ *
+ * The elements are pairs of a key and its value, whose key must not be
+ * modified through an iterator.
+ *
+ * @ingroup containers
+ *
+ * @tparam Key_t: The type of key
+ * @tparam Mapped_t: The type of value associated to each key
+ * @tparam Hash_t: Hashes the keys
+ * @tparam Key_Equal_t: Compares two keys for equality
+ * @tparam Allocator_t: The type of allocator used for memory management
+ */
+template<
+    typename Key_t,
+    typename Mapped_t,
+    typename Hash_t      = std::hash<Key_t>,
+    typename Key_Equal_t = std::equal_to<Key_t>,
+    typename Allocator_t = Default_Allocator<std::pair<Key_t, Mapped_t>>>
+class Flat_Hash_Map
+{
+ private:
+	using Alloc_Traits =
+	    Allocator_Traits<typename Allocator_t::template rebind<std::pair<Key_t, Mapped_t>>>;
+	using Group          = detail::Control_Group;
+	using Byte_Allocator = typename Allocator_t::template rebind<std::uint8_t>;
+
+	// The control bytes are loaded straight into vector registers, so they
+	// use the default allocator when the given one wraps its elements
+	static constexpr bool raw_control =
+	    std::is_same_v<typename Allocator_Traits<Byte_Allocator>::Pointer, std::uint8_t *>;
+	using Control_Allocator =
+	    std::conditional_t<raw_control, Byte_Allocator, Default_Allocator<std::uint8_t>>;
+	using Control = Dynamic_Array<std::uint8_t, Control_Allocator>;
+
+	template<bool Is_Const>
+	class Iterator_Detail
+	{
+	 private:
+		using Map = std::conditional_t<Is_Const, Flat_Hash_Map const, Flat_Hash_Map>;
+
+	 public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = typename Alloc_Traits::Value;
+		using reference         = std::conditional_t<
+		    Is_Const,
+		    typename Alloc_Traits::Const_Reference,
+		    typename Alloc_Traits::Reference>;
+		using pointer           = std::conditional_t<
+		    Is_Const,
+		    typename Alloc_Traits::Const_Pointer,
+		    typename Alloc_Traits::Pointer>;
+
+		Iterator_Detail() = default;
+
+		Iterator_Detail(Map *map, std::size_t index) : m_map(map), m_index(index) {
+		}
+
+		/// @brief Allows converting an Iterator into a Const_Iterator
+		operator Iterator_Detail<true>() const
+		    requires(!Is_Const)
+		{
+			return {m_map, m_index};
+		}
+
+		Iterator_Detail &operator++() {
+			m_index = m_map->next_occupied(m_index + 1);
+			return *this;
+		}
+
+		Iterator_Detail operator++(int) {
+			Iterator_Detail iterator = *this;
+			++*this;
+			return iterator;
+		}
+
+		bool operator==(Iterator_Detail const &iterator) const = default;
+
+		reference operator*() const {
+			return m_map->m_slots[m_index];
+		}
+
+		pointer operator->() const {
+			return m_map->m_slots + m_index;
+		}
+
+	 private:
+		friend Flat_Hash_Map;
+
+		Map        *m_map   = nullptr;
+		std::size_t m_index = 0;
+	};
+
+ public:
+	using Allocator       = typename Alloc_Traits::Allocator;
+	using Value           = typename Alloc_Traits::Value;
+	using Reference       = typename Alloc_Traits::Reference;
+	using Const_Reference = typename Alloc_Traits::Const_Reference;
+	using Pointer         = typename Alloc_Traits::Pointer;
+	using Const_Pointer   = typename Alloc_Traits::Const_Pointer;
+	using Iterator        = Iterator_Detail<false>;
+	using Const_Iterator  = Iterator_Detail<true>;
+	using Key             = Key_t;
+	using Mapped          = Mapped_t;
+	using Hash            = Hash_t;
+	using Key_Equal       = Key_Equal_t;
+
+	[[nodiscard]] Allocator const &allocator() const {
+		return m_allocator;
+	}
+
+	/**
+	 * @brief Constructs an empty map, which allocates no slots until the
+	 * first insertion
+	 */
+	explicit Flat_Hash_Map(Allocator allocator = Allocator{})
+	    : Flat_Hash_Map(0, std::move(allocator)) {
+	}
+
+	/**
+	 * @brief Constructs an empty map with enough slots for the given number
+	 * of elements
+	 */
+	explicit Flat_Hash_Map(std::size_t count, Allocator allocator = Allocator{})
+	    : m_allocator(std::move(allocator))
+	    , m_control(control_allocator()) {
+		reserve(count);
+	}
+
+	~Flat_Hash_Map() {
+		clear();
+		if (m_slots != nullptr)
+		{
+			Alloc_Traits::deallocate(m_allocator, m_slots, m_capacity);
+		}
+	}
+
+	Flat_Hash_Map(Flat_Hash_Map const &map)
+	    : m_hash(map.m_hash)
+	    , m_key_equal(map.m_key_equal)
+	    , m_allocator(Alloc_Traits::propogate_or_create_instance(map.m_allocator))
+	    , m_slots(allocate_slots(map.m_capacity))
+	    , m_control(map.m_control)
+	    , m_size(map.m_size)
+	    , m_capacity(map.m_capacity)
+	    , m_shift(map.m_shift) {
+		for (Const_Iterator i = map.begin(); i != map.end(); ++i)
+		{
+			Alloc_Traits::construct(m_allocator, m_slots + i.m_index, *i);
+		}
+	}
+
+	Flat_Hash_Map &operator=(Flat_Hash_Map const &map) {
+		using std::swap;
+
+		Flat_Hash_Map copy(map);
+		swap(*this, copy);
+		return *this;
+	}
+
+	Flat_Hash_Map(Flat_Hash_Map &&map) noexcept
+	    : m_hash(std::move(map.m_hash))
+	    , m_key_equal(std::move(map.m_key_equal))
+	    , m_allocator(std::move(map.m_allocator))
+	    , m_slots(std::exchange(map.m_slots, nullptr))
+	    , m_control(std::move(map.m_control))
+	    , m_size(std::exchange(map.m_size, 0))
+	    , m_capacity(std::exchange(map.m_capacity, 0))
+	    , m_shift(map.m_shift) {
+	}
+
+	Flat_Hash_Map &operator=(Flat_Hash_Map &&map) noexcept {
+		using std::swap;
+
+		swap(*this, map);
+		return *this;
+	}
+
+	friend void swap(Flat_Hash_Map &lhs, Flat_Hash_Map &rhs) noexcept {
+		using std::swap;
+
+		swap(lhs.m_hash, rhs.m_hash);
+		swap(lhs.m_key_equal, rhs.m_key_equal);
+		swap(lhs.m_allocator, rhs.m_allocator);
+		swap(lhs.m_slots, rhs.m_slots);
+		swap(lhs.m_control, rhs.m_control);
+		swap(lhs.m_size, rhs.m_size);
+		swap(lhs.m_capacity, rhs.m_capacity);
+		swap(lhs.m_shift, rhs.m_shift);
+	}
+
+	[[nodiscard]] Iterator begin() {
+		return {this, next_occupied(0)};
+	}
+
+	[[nodiscard]] Const_Iterator begin() const {
+		return {this, next_occupied(0)};
+	}
+
+	[[nodiscard]] Iterator end() {
+		return {this, m_capacity};
+	}
+
+	[[nodiscard]] Const_Iterator end() const {
+		return {this, m_capacity};
+	}
+
+	[[nodiscard]] std::size_t size() const {
+		return m_size;
+	}
+
+	[[nodiscard]] bool empty() const {
+		return m_size == 0;
+	}
+
+	/**
+	 * @brief Returns the number of slots, of which up to seven eighths are
+	 * filled before the map grows
+	 */
+	[[nodiscard]] std::size_t capacity() const {
+		return m_capacity;
+	}
+
+	/**
+	 * @brief Makes room for the given number of elements, so that inserting
+	 * them does not rehash the map
+	 */
+	void reserve(std::size_t count) {
+		std::size_t const capacity = capacity_for(count);
+		if (capacity > m_capacity)
+		{
+			rehash(capacity);
+		}
+	}
+
+	/**
+	 * @brief Destroys every element but keeps the slots for reuse
+	 */
+	void clear() {
+		for (Iterator i = begin(); i != end(); ++i)
+		{
+			Alloc_Traits::destroy(m_allocator, m_slots + i.m_index);
+		}
+		reset_control();
+		m_size = 0;
+	}
+
+	/**
+	 * @brief Associates the key with a copy of the given value unless the
+	 * key is already present
+	 * @return The element with the key and whether it was inserted
+	 */
+	std::pair<Iterator, bool> insert(Key const &key, Mapped const &mapped) {
+		return emplace_unique(key, key, mapped);
+	}
+
+	std::pair<Iterator, bool> insert(Key const &key, Mapped &&mapped) {
+		return emplace_unique(key, key, std::move(mapped));
+	}
+
+	/**
+	 * @brief Associates the key with a value constructed from the given
+	 * arguments unless the key is already present, in which case nothing is
+	 * constructed
+	 * @return The element with the key and whether it was inserted
+	 */
+	template<typename... Arguments>
+	std::pair<Iterator, bool> try_emplace(Key const &key, Arguments &&...arguments) {
+		return emplace_unique(
+		    key,
+		    std::piecewise_construct,
+		    std::forward_as_tuple(key),
+		    std::forward_as_tuple(std::forward<Arguments>(arguments)...));
+	}
+
+	/**
+	 * @brief Returns the value associated with the key, inserting a default
+	 * constructed one if the key is not present
+	 */
+	Mapped &operator[](Key const &key) {
+		return try_emplace(key).first->second;
+	}
+
+	[[nodiscard]] Iterator find(Key const &key) {
+		return {this, find_index(key, mix(key))};
+	}
+
+	[[nodiscard]] Const_Iterator find(Key const &key) const {
+		return {this, find_index(key, mix(key))};
+	}
+
+	/**
+	 * @brief Finds the element whose key is equal to the given value, which
+	 * is hashed and compared as is when the hash and key comparison are
+	 * transparent
+	 */
+	template<typename Lookup>
+	    requires detail::Transparent_Lookup<Hash, Key_Equal>
+	[[nodiscard]] Iterator find(Lookup const &key) {
+		return {this, find_index(key, mix(key))};
+	}
+
+	template<typename Lookup>
+	    requires detail::Transparent_Lookup<Hash, Key_Equal>
+	[[nodiscard]] Const_Iterator find(Lookup const &key) const {
+		return {this, find_index(key, mix(key))};
+	}
+
+	[[nodiscard]] bool contains(Key const &key) const {
+		return find_index(key, mix(key)) != m_capacity;
+	}
+
+	template<typename Lookup>
+	    requires detail::Transparent_Lookup<Hash, Key_Equal>
+	[[nodiscard]] bool contains(Lookup const &key) const {
+		return find_index(key, mix(key)) != m_capacity;
+	}
+
+	/**
+	 * @brief Removes the element with the given key
+	 * @return false if there was no such element
+	 */
+	bool erase(Key const &key) {
+		return erase_found(key);
+	}
+
+	template<typename Lookup>
+	    requires detail::Transparent_Lookup<Hash, Key_Equal>
+	bool erase(Lookup const &key) {
+		return erase_found(key);
+	}
+
+ private:
+	static constexpr std::size_t  minimum_capacity  = Group::width;
+	static constexpr std::uint8_t saturated         = 0xFF;
+	static constexpr int          fingerprint_shift = 57;
+
+	[[no_unique_address]] Hash      m_hash;
+	[[no_unique_address]] Key_Equal m_key_equal;
+	Allocator                       m_allocator;
+	Pointer                         m_slots = nullptr;
+	// A control byte for every slot followed by the overflow count of every
+	// group
+	Control                         m_control;
+	std::size_t                     m_size     = 0;
+	std::size_t                     m_capacity = 0;
+	int                             m_shift    = fingerprint_shift;
+
+	static constexpr std::size_t capacity_for(std::size_t count) {
+		if (count == 0)
+		{
+			return 0;
+		}
+		return std::max(minimum_capacity, std::bit_ceil(count + (count + 6) / 7));
+	}
+
+	static constexpr std::size_t max_size_for(std::size_t capacity) {
+		return capacity / 8 * 7;
+	}
+
+	static std::uint8_t fingerprint(std::uint64_t mixed) {
+		return static_cast<std::uint8_t>(mixed >> fingerprint_shift);
+	}
+
+	Control_Allocator control_allocator() const {
+		if constexpr (raw_control)
+		{
+			return Control_Allocator(m_allocator);
+		}
+		else
+		{
+			return Control_Allocator{};
+		}
+	}
+
+	Pointer allocate_slots(std::size_t capacity) {
+		return capacity == 0 ? nullptr : Alloc_Traits::allocate(m_allocator, capacity);
+	}
+
+	[[nodiscard]] std::size_t group_count() const {
+		return m_capacity / Group::width;
+	}
+
+	[[nodiscard]] std::uint8_t &overflow(std::size_t group) {
+		return m_control[m_capacity + group];
+	}
+
+	[[nodiscard]] std::uint8_t overflow(std::size_t group) const {
+		return m_control[m_capacity + group];
+	}
+
+	[[nodiscard]] Group load_group(std::size_t group) const {
+		return Group(m_control.data() + group * Group::width);
+	}
+
+	template<typename Lookup>
+	[[nodiscard]] std::uint64_t mix(Lookup const &key) const {
+		return detail::fibonacci_mix(m_hash(key));
+	}
+
+	/// @brief Returns the group selected by the bits just below the
+	/// fingerprint, which is the first one probed for the key
+	[[nodiscard]] std::size_t home_group(std::uint64_t mixed) const {
+		return detail::mixed_index(mixed, m_shift) & (group_count() - 1);
+	}
+
+	/// @brief Moves to the next group of a probe sequence, after the given
+	/// number of steps. Stepping by one more group every time visits every
+	/// group once in the first group_count steps
+	[[nodiscard]] std::size_t next_group(std::size_t group, std::size_t step) const {
+		return (group + step) & (group_count() - 1);
+	}
+
+	[[nodiscard]] std::size_t next_occupied(std::size_t index) const {
+		while (index < m_capacity && m_control[index] == Group::empty)
+		{
+			++index;
+		}
+		return index;
+	}
+
+	void reset_control() {
+		std::fill_n(m_control.begin(), m_capacity, Group::empty);
+		std::fill_n(m_control.begin() + m_capacity, group_count(), std::uint8_t{0});
+	}
+
+	/**
+	 * @return The slot holding the key, or the capacity if there is none
+	 */
+	template<typename Lookup>
+	[[nodiscard]] std::size_t find_index(Lookup const &key, std::uint64_t mixed) const {
+		if (m_size == 0)
+		{
+			return m_capacity;
+		}
+
+		std::uint8_t const wanted = fingerprint(mixed);
+		std::size_t        group  = home_group(mixed);
+		for (std::size_t step = 1; step <= group_count(); ++step)
+		{
+			std::size_t const first   = group * Group::width;
+			std::uint32_t     matches = load_group(group).match(wanted);
+			for (; matches != 0; matches &= matches - 1)
+			{
+				std::size_t const index =
+				    first + static_cast<std::size_t>(std::countr_zero(matches));
+				if (m_key_equal(m_slots[index].first, key))
+				{
+					return index;
+				}
+			}
+
+			if (overflow(group) == 0)
+			{
+				return m_capacity;
+			}
+			group = next_group(group, step);
+		}
+		return m_capacity;
+	}
+
+	template<typename... Arguments>
+	std::pair<Iterator, bool> emplace_unique(Key const &key, Arguments &&...arguments) {
+		std::uint64_t const mixed = mix(key);
+		std::size_t const   found = find_index(key, mixed);
+		if (found != m_capacity)
+		{
+			return {Iterator(this, found), false};
+		}
+
+		if (m_size + 1 > max_size_for(m_capacity))
+		{
+			// The element is built before growing, so that the arguments
+			// may refer to elements of the map
+			Value value(std::forward<Arguments>(arguments)...);
+			rehash(capacity_for(m_size + 1));
+			return {Iterator(this, place(mixed, std::move(value))), true};
+		}
+		return {Iterator(this, place(mixed, std::forward<Arguments>(arguments)...)), true};
+	}
+
+	/**
+	 * @brief Constructs an element whose key is not in the map, which must
+	 * have an empty slot, in the first group with an empty slot along the
+	 * probe sequence of its hash, counting it as an overflow of every full
+	 * group before
+	 * @return The slot of the element
+	 */
+	template<typename... Arguments>
+	std::size_t place(std::uint64_t mixed, Arguments &&...arguments) {
+		std::size_t   group   = home_group(mixed);
+		std::size_t   step    = 1;
+		std::uint32_t empties = load_group(group).match_empty();
+		while (empties == 0)
+		{
+			std::uint8_t &count = overflow(group);
+			if (count != saturated)
+			{
+				++count;
+			}
+			group   = next_group(group, step++);
+			empties = load_group(group).match_empty();
+		}
+
+		std::size_t const index =
+		    group * Group::width + static_cast<std::size_t>(std::countr_zero(empties));
+		Alloc_Traits::construct(
+		    m_allocator,
+		    m_slots + index,
+		    std::forward<Arguments>(arguments)...);
+		m_control[index] = fingerprint(mixed);
+		++m_size;
+		return index;
+	}
+
+	template<typename Lookup>
+	bool erase_found(Lookup const &key) {
+		std::uint64_t const mixed = mix(key);
+		std::size_t const   index = find_index(key, mixed);
+		if (index == m_capacity)
+		{
+			return false;
+		}
+
+		Alloc_Traits::destroy(m_allocator, m_slots + index);
+		m_control[index] = Group::empty;
+		--m_size;
+
+		// The element no longer overflows the groups it was placed after
+		std::size_t const last  = index / Group::width;
+		std::size_t       group = home_group(mixed);
+		for (std::size_t step = 1; group != last; ++step)
+		{
+			std::uint8_t &count = overflow(group);
+			if (count != saturated)
+			{
+				--count;
+			}
+			group = next_group(group, step);
+		}
+		return true;
+	}
+
+	void rehash(std::size_t capacity) {
+		Pointer const     slots             = m_slots;
+		Control const     control           = std::move(m_control);
+		std::size_t const previous_capacity = m_capacity;
+
+		m_slots    = allocate_slots(capacity);
+		m_control  = Control(capacity + capacity / Group::width, 0, control_allocator());
+		m_size     = 0;
+		m_capacity = capacity;
+		m_shift    = fingerprint_shift - std::countr_zero(group_count());
+		reset_control();
+
+		for (std::size_t index = 0; index < previous_capacity; ++index)
+		{
+			if (control[index] != Group::empty)
+			{
+				place(mix(slots[index].first), std::move(slots[index]));
+				Alloc_Traits::destroy(m_allocator, slots + index);
+			}
+		}
+
+		if (slots != nullptr)
+		{
+			Alloc_Traits::deallocate(m_allocator, slots, previous_capacity);
+		}
+	}
+};
+
+} // namespace dsa
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef DSA_GROWTH_POLICY_HPP
+#define DSA_GROWTH_POLICY_HPP
+
+#include <algorithm>
+#include <cstddef>
+
+namespace dsa
+{
+
+/**
+ * @brief Decides how the capacity of a Vector changes as elements are added or
+ * removed. The capacity grows by a factor of Numerator / Denominator whenever
+ * the storage is full. Once the size falls to a Shrink_Threshold-th of the
+ * capacity, the capacity is halved once per removal. The gap between the
+ * threshold and the halving provides hysteresis, so that a size which
+ * oscillates around the shrink point does not reallocate on every cycle.
+ *
+ * @tparam Numerator: The numerator of the grow factor
+ * @tparam Denominator: The denominator of the grow factor
+ * @tparam Shrink_Threshold: The fraction of the capacity below which the
+ * storage is shrunk, zero disables shrinking
+ */
+template<std::size_t Numerator, std::size_t Denominator, std::size_t Shrink_Threshold>
+class Geometric_Growth_Policy
+{
+	static_assert(Numerator > Denominator, "The capacity must increase when growing");
+	static_assert(
+	    Shrink_Threshold == 0 || Shrink_Threshold > 2,
+	    "Shrinking by half must leave space to grow before shrinking again");
+
+ public:
+	/**
+	 * @brief Returns the capacity to use once the given capacity is full
+	 */
+	[[nodiscard]] static constexpr std::size_t grow_capacity(std::size_t capacity) {
+		return std::max(capacity + 1, capacity * Numerator / Denominator);
+	}
+
+	/**
+	 * @brief Returns the capacity to use after the number of elements
+	 * dropped to the given size. Returning the current capacity keeps the
+	 * storage as it is
+	 */
+	[[nodiscard]] static constexpr std::size_t shrink_capacity(
+	    std::size_t size,
+	    std::size_t capacity) {
+		if constexpr (Shrink_Threshold == 0)
+		{
+			return capacity;
+		}
+		else
+		{
+			if (capacity / Shrink_Threshold >= size)
+			{
+				return capacity / 2;
+			}
+			return capacity;
+		}
+	}
+};
+
+/**
+ * @brief Doubles the capacity when full and halves it once only a quarter is
+ * in use
+ */
+using Default_Growth_Policy = Geometric_Growth_Policy<2, 1, 4>;
+
+/**
+ * @brief Doubles the capacity when full and never gives memory back, useful
+ * for workloads which repeatedly drain and refill the container
+ */
+using Never_Shrink_Growth_Policy = Geometric_Growth_Policy<2, 1, 0>;
+
+/**
+ * @brief Grows the capacity by half when full, trading more reallocations for
+ * less unused memory, and halves it once only a quarter is in use
+ */
+using One_And_A_Half_Growth_Policy = Geometric_Growth_Policy<3, 2, 4>;
+
+} // namespace dsa
+
+#endif
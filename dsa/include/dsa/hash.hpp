@@ -0,0 +1,42 @@
+#ifndef DSA_HASH_HPP
+#define DSA_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace dsa
+{
+
+namespace detail
+{
+
+/**
+ * @brief Multiplies the hash by 2^64 divided by the golden ratio. This spreads
+ * hashes which differ only in their high or low bits, such as the identity hash
+ * of integers, into the high bits of the result, which hash tables use to pick
+ * a slot.
+ */
+[[nodiscard]] constexpr std::uint64_t fibonacci_mix(std::uint64_t hash) {
+	return hash * 0x9E37'79B9'7F4A'7C15;
+}
+
+/// @brief Returns the bits of the mixed hash above the given shift as an
+/// index, narrowing only where std::size_t is smaller than 64 bits
+template<typename Mixed>
+[[nodiscard]] constexpr std::size_t mixed_index(Mixed mixed, int shift) {
+	if constexpr (std::is_same_v<Mixed, std::size_t>)
+	{
+		return mixed >> shift;
+	}
+	else
+	{
+		return static_cast<std::size_t>(mixed >> shift);
+	}
+}
+
+} // namespace detail
+
+} // namespace dsa
+
+#endif
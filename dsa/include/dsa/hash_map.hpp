@@ -0,0 +1,94 @@
+#ifndef DSA_HASH_MAP_HPP
+#define DSA_HASH_MAP_HPP
+
+#include <dsa/default_allocator.hpp>
+#include <dsa/hash_table.hpp>
+
+#include <functional>
+#include <tuple>
+#include <utility>
+
+namespace dsa
+{
+
+/**
+ * @brief Maps unique keys to values in a flat open addressing hash table, see
+ * detail::Hash_Table. The elements are pairs of a key and its value, whose
+ * key must not be modified through an iterator.
+ *
+ * @ingroup containers
+ *
+ * @tparam Key_t: The type of key
+ * @tparam Mapped_t: The type of value associated to each key
+ * @tparam Hash_t: Hashes the keys
+ * @tparam Key_Equal_t: Compares two keys for equality
+ * @tparam Allocator_t: The type of allocator used for memory management
+ */
+template<
+    typename Key_t,
+    typename Mapped_t,
+    typename Hash_t      = std::hash<Key_t>,
+    typename Key_Equal_t = std::equal_to<Key_t>,
+    typename Allocator_t = Default_Allocator<std::pair<Key_t, Mapped_t>>>
+class Hash_Map : public detail::Hash_Table<
+                     std::pair<Key_t, Mapped_t>,
+                     detail::Map_Key,
+                     Hash_t,
+                     Key_Equal_t,
+                     Allocator_t>
+{
+ private:
+	using Table = detail::Hash_Table<
+	    std::pair<Key_t, Mapped_t>,
+	    detail::Map_Key,
+	    Hash_t,
+	    Key_Equal_t,
+	    Allocator_t>;
+
+ public:
+	using Mapped   = Mapped_t;
+	using Key      = typename Table::Key;
+	using Iterator = typename Table::Iterator;
+
+	using Table::Table;
+
+	/**
+	 * @brief Associates the key with a copy of the given value unless the
+	 * key is already present
+	 * @return The element with the key and whether it was inserted
+	 */
+	std::pair<Iterator, bool> insert(Key const &key, Mapped const &mapped) {
+		return this->insert_unique(key, key, mapped);
+	}
+
+	std::pair<Iterator, bool> insert(Key const &key, Mapped &&mapped) {
+		return this->insert_unique(key, key, std::move(mapped));
+	}
+
+	/**
+	 * @brief Associates the key with a value constructed from the given
+	 * arguments unless the key is already present, in which case nothing is
+	 * constructed
+	 * @return The element with the key and whether it was inserted
+	 */
+	template<typename... Arguments>
+	std::pair<Iterator, bool> try_emplace(Key const &key, Arguments &&...arguments) {
+		return this->insert_unique(
+		    key,
+		    std::piecewise_construct,
+		    std::forward_as_tuple(key),
+		    std::forward_as_tuple(std::forward<Arguments>(arguments)...));
+	}
+
+	/**
+	 * @brief Returns the value associated with the key, inserting a default
+	 * constructed one if the key is not present
+	 */
+	Mapped &operator[](Key const &key) {
+		return try_emplace(key).first->second;
+	}
+};
+
+} // namespace dsa
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef DSA_HASH_SET_HPP
+#define DSA_HASH_SET_HPP
+
+#include <dsa/default_allocator.hpp>
+#include <dsa/hash_table.hpp>
+
+#include <functional>
+#include <utility>
+
+namespace dsa
+{
+
+/**
+ * @brief Holds unique keys in a flat open addressing hash table, see
+ * detail::Hash_Table. The keys can only be read through iterators, as changing
+ * them would misplace them in the table.
+ *
+ * @ingroup containers
+ *
+ * @tparam Key_t: The type of key
+ * @tparam Hash_t: Hashes the keys
+ * @tparam Key_Equal_t: Compares two keys for equality
+ * @tparam Allocator_t: The type of allocator used for memory management
+ */
+template<
+    typename Key_t,
+    typename Hash_t      = std::hash<Key_t>,
+    typename Key_Equal_t = std::equal_to<Key_t>,
+    typename Allocator_t = Default_Allocator<Key_t>>
+class Hash_Set : public detail::Hash_Table<Key_t, detail::Set_Key, Hash_t, Key_Equal_t, Allocator_t>
+{
+ private:
+	using Table = detail::Hash_Table<Key_t, detail::Set_Key, Hash_t, Key_Equal_t, Allocator_t>;
+
+ public:
+	using Key            = typename Table::Key;
+	using Iterator       = typename Table::Const_Iterator;
+	using Const_Iterator = typename Table::Const_Iterator;
+
+	using Table::Table;
+
+	[[nodiscard]] Iterator begin() const {
+		return Table::begin();
+	}
+
+	[[nodiscard]] Iterator end() const {
+		return Table::end();
+	}
+
+	[[nodiscard]] Iterator find(Key const &key) const {
+		return Table::find(key);
+	}
+
+	/**
+	 * @brief Inserts the key unless it is already present
+	 * @return The element with the key and whether it was inserted
+	 */
+	std::pair<Iterator, bool> insert(Key const &key) {
+		auto const [element, inserted] = this->insert_unique(key, key);
+		return {element, inserted};
+	}
+
+	std::pair<Iterator, bool> insert(Key &&key) {
+		auto const [element, inserted] = this->insert_unique(key, std::move(key));
+		return {element, inserted};
+	}
+};
+
+} // namespace dsa
+
+#endif
@@ -0,0 +1,517 @@
+#ifndef DSA_HASH_TABLE_HPP
+#define DSA_HASH_TABLE_HPP
+
+#include <dsa/allocator_traits.hpp>
+#include <dsa/dynamic_array.hpp>
+#include <dsa/hash.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace dsa
+{
+
+namespace detail
+{
+
+/// @brief Returns the key of a set element, which is the element itself
+struct Set_Key
+{
+	template<typename Value>
+	Value const &operator()(Value const &value) const {
+		return value;
+	}
+};
+
+/// @brief Returns the key of a map element, which is the first of the pair
+struct Map_Key
+{
+	template<typename Pair>
+	auto const &operator()(Pair const &pair) const {
+		return pair.first;
+	}
+};
+
+/**
+ * @brief Stores unique elements in a flat array of slots with open addressing
+ * and robin hood linear probing. Every element sits at or after the slot its
+ * hash selects, its home, and the elements of a run of occupied slots are kept
+ * ordered by their home. Lookups can therefore stop at the first slot holding
+ * an element closer to its home than the searched key would be, and erasing
+ * shifts the rest of the run back instead of leaving a tombstone.
+ *
+ * The distance of every slot from its home is kept in a separate
+ * Dynamic_Array, where zero marks an empty slot, so probing only touches the
+ * small distances until a candidate element is found.
+ *
+ * @tparam Value_t: The type of element to store
+ * @tparam Key_Of_t: Returns the key of an element
+ * @tparam Hash_t: Hashes the keys
+ * @tparam Key_Equal_t: Compares two keys for equality
+ * @tparam Allocator_t: The type of allocator used for memory management
+ */
+template<
+    typename Value_t,
+    typename Key_Of_t,
+    typename Hash_t,
+    typename Key_Equal_t,
+    typename Allocator_t>
+class Hash_Table
+{
+ private:
+	using Alloc_Traits = Allocator_Traits<typename Allocator_t::template rebind<Value_t>>;
+	using Distance     = std::uint32_t;
+	using Distances =
+	    Dynamic_Array<Distance, typename Allocator_t::template rebind<Distance>>;
+
+	template<bool Is_Const>
+	class Iterator_Detail
+	{
+	 private:
+		using Table = std::conditional_t<Is_Const, Hash_Table const, Hash_Table>;
+
+	 public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = typename Alloc_Traits::Value;
+		using reference         = std::conditional_t<
+		    Is_Const,
+		    typename Alloc_Traits::Const_Reference,
+		    typename Alloc_Traits::Reference>;
+		using pointer           = std::conditional_t<
+		    Is_Const,
+		    typename Alloc_Traits::Const_Pointer,
+		    typename Alloc_Traits::Pointer>;
+
+		Iterator_Detail() = default;
+
+		Iterator_Detail(Table *table, std::size_t index) : m_table(table), m_index(index) {
+		}
+
+		/// @brief Allows converting an Iterator into a Const_Iterator
+		operator Iterator_Detail<true>() const
+		    requires(!Is_Const)
+		{
+			return {m_table, m_index};
+		}
+
+		Iterator_Detail &operator++() {
+			m_index = m_table->next_occupied(m_index + 1);
+			return *this;
+		}
+
+		Iterator_Detail operator++(int) {
+			Iterator_Detail iterator = *this;
+			++*this;
+			return iterator;
+		}
+
+		bool operator==(Iterator_Detail const &iterator) const = default;
+
+		reference operator*() const {
+			return m_table->m_slots[m_index];
+		}
+
+		pointer operator->() const {
+			return m_table->m_slots + m_index;
+		}
+
+	 private:
+		friend Hash_Table;
+
+		Table      *m_table = nullptr;
+		std::size_t m_index = 0;
+	};
+
+ public:
+	using Allocator       = typename Alloc_Traits::Allocator;
+	using Value           = typename Alloc_Traits::Value;
+	using Reference       = typename Alloc_Traits::Reference;
+	using Const_Reference = typename Alloc_Traits::Const_Reference;
+	using Pointer         = typename Alloc_Traits::Pointer;
+	using Const_Pointer   = typename Alloc_Traits::Const_Pointer;
+	using Iterator        = Iterator_Detail<false>;
+	using Const_Iterator  = Iterator_Detail<true>;
+	using Key_Of          = Key_Of_t;
+	using Hash            = Hash_t;
+	using Key_Equal       = Key_Equal_t;
+	using Key = std::remove_cvref_t<decltype(Key_Of{}(std::declval<Value const &>()))>;
+
+	/**
+	 * @brief Returns the number of bytes a table reserved for the given
+	 * number of elements allocates, including padding for the alignment of
+	 * its two arrays
+	 */
+	[[nodiscard]] static constexpr std::size_t allocation_size(std::size_t count) {
+		std::size_t const capacity = capacity_for(count);
+		return capacity * (sizeof(Value) + sizeof(Distance)) + alignof(Distance);
+	}
+
+	[[nodiscard]] Allocator const &allocator() const {
+		return m_allocator;
+	}
+
+	/**
+	 * @brief Constructs an empty table, which allocates no slots until the
+	 * first insertion
+	 */
+	explicit Hash_Table(Allocator allocator = Allocator{})
+	    : Hash_Table(0, std::move(allocator)) {
+	}
+
+	/**
+	 * @brief Constructs an empty table with enough slots for the given number
+	 * of elements
+	 */
+	explicit Hash_Table(std::size_t count, Allocator allocator = Allocator{})
+	    : m_allocator(std::move(allocator))
+	    , m_distances(0, 0, typename Distances::Allocator(m_allocator)) {
+		reserve(count);
+	}
+
+	~Hash_Table() {
+		clear();
+		if (m_slots != nullptr)
+		{
+			Alloc_Traits::deallocate(m_allocator, m_slots, m_capacity);
+		}
+	}
+
+	Hash_Table(Hash_Table const &table)
+	    : m_hash(table.m_hash)
+	    , m_key_equal(table.m_key_equal)
+	    , m_allocator(Alloc_Traits::propogate_or_create_instance(table.m_allocator))
+	    , m_slots(allocate_slots(table.m_capacity))
+	    , m_distances(table.m_distances)
+	    , m_size(table.m_size)
+	    , m_capacity(table.m_capacity)
+	    , m_shift(table.m_shift) {
+		for (Const_Iterator i = table.begin(); i != table.end(); ++i)
+		{
+			Alloc_Traits::construct(m_allocator, m_slots + i.m_index, *i);
+		}
+	}
+
+	Hash_Table &operator=(Hash_Table const &table) {
+		using std::swap;
+
+		Hash_Table copy(table);
+		swap(*this, copy);
+		return *this;
+	}
+
+	Hash_Table(Hash_Table &&table) noexcept
+	    : m_hash(std::move(table.m_hash))
+	    , m_key_equal(std::move(table.m_key_equal))
+	    , m_allocator(std::move(table.m_allocator))
+	    , m_slots(std::exchange(table.m_slots, nullptr))
+	    , m_distances(std::move(table.m_distances))
+	    , m_size(std::exchange(table.m_size, 0))
+	    , m_capacity(std::exchange(table.m_capacity, 0))
+	    , m_shift(table.m_shift) {
+	}
+
+	Hash_Table &operator=(Hash_Table &&table) noexcept {
+		using std::swap;
+
+		swap(*this, table);
+		return *this;
+	}
+
+	friend void swap(Hash_Table &lhs, Hash_Table &rhs) noexcept {
+		using std::swap;
+
+		swap(lhs.m_hash, rhs.m_hash);
+		swap(lhs.m_key_equal, rhs.m_key_equal);
+		swap(lhs.m_allocator, rhs.m_allocator);
+		swap(lhs.m_slots, rhs.m_slots);
+		swap(lhs.m_distances, rhs.m_distances);
+		swap(lhs.m_size, rhs.m_size);
+		swap(lhs.m_capacity, rhs.m_capacity);
+		swap(lhs.m_shift, rhs.m_shift);
+	}
+
+	[[nodiscard]] Iterator begin() {
+		return {this, next_occupied(0)};
+	}
+
+	[[nodiscard]] Const_Iterator begin() const {
+		return {this, next_occupied(0)};
+	}
+
+	[[nodiscard]] Iterator end() {
+		return {this, m_capacity};
+	}
+
+	[[nodiscard]] Const_Iterator end() const {
+		return {this, m_capacity};
+	}
+
+	[[nodiscard]] std::size_t size() const {
+		return m_size;
+	}
+
+	[[nodiscard]] bool empty() const {
+		return m_size == 0;
+	}
+
+	/**
+	 * @brief Returns the number of slots, of which up to seven eighths are
+	 * filled before the table grows
+	 */
+	[[nodiscard]] std::size_t capacity() const {
+		return m_capacity;
+	}
+
+	/**
+	 * @brief Makes room for the given number of elements, so that inserting
+	 * them does not rehash the table
+	 */
+	void reserve(std::size_t count) {
+		std::size_t const capacity = capacity_for(count);
+		if (capacity > m_capacity)
+		{
+			rehash(capacity);
+		}
+	}
+
+	/**
+	 * @brief Destroys every element but keeps the slots for reuse
+	 */
+	void clear() {
+		for (Iterator i = begin(); i != end(); ++i)
+		{
+			Alloc_Traits::destroy(m_allocator, m_slots + i.m_index);
+			m_distances[i.m_index] = 0;
+		}
+		m_size = 0;
+	}
+
+	[[nodiscard]] Iterator find(Key const &key) {
+		Probe const probe = find_probe(key);
+		return {this, probe.m_found ? probe.m_index : m_capacity};
+	}
+
+	[[nodiscard]] Const_Iterator find(Key const &key) const {
+		Probe const probe = find_probe(key);
+		return {this, probe.m_found ? probe.m_index : m_capacity};
+	}
+
+	[[nodiscard]] bool contains(Key const &key) const {
+		return find_probe(key).m_found;
+	}
+
+	/**
+	 * @brief Removes the element with the given key
+	 * @return false if there was no such element
+	 */
+	bool erase(Key const &key) {
+		Probe const probe = find_probe(key);
+		if (!probe.m_found)
+		{
+			return false;
+		}
+
+		// Shift the rest of the run back until an empty slot or an element
+		// at its home, which keeps every element reachable from its home
+		std::size_t index = probe.m_index;
+		std::size_t next  = next_slot(index);
+		while (m_distances[next] > 1)
+		{
+			m_slots[index]     = std::move(m_slots[next]);
+			m_distances[index] = m_distances[next] - 1;
+			index              = next;
+			next               = next_slot(next);
+		}
+
+		Alloc_Traits::destroy(m_allocator, m_slots + index);
+		m_distances[index] = 0;
+		--m_size;
+		return true;
+	}
+
+ protected:
+	/**
+	 * @brief Constructs an element from the given arguments unless an element
+	 * with the given key, which must be the key of the constructed element,
+	 * is already present
+	 * @return The element with the key and whether it was inserted
+	 */
+	template<typename... Arguments>
+	std::pair<Iterator, bool> insert_unique(Key const &key, Arguments &&...arguments) {
+		Probe const probe = find_probe(key);
+		if (probe.m_found)
+		{
+			return {Iterator(this, probe.m_index), false};
+		}
+
+		// The element is built before growing, so that the arguments may
+		// refer to elements of the table
+		Value value(std::forward<Arguments>(arguments)...);
+		if (m_size + 1 > max_size_for(m_capacity))
+		{
+			rehash(capacity_for(m_size + 1));
+		}
+		return {Iterator(this, place(std::move(value))), true};
+	}
+
+ private:
+	static constexpr std::size_t minimum_capacity = 8;
+
+	struct Probe
+	{
+		std::size_t m_index;
+		bool        m_found;
+	};
+
+	[[no_unique_address]] Hash      m_hash;
+	[[no_unique_address]] Key_Equal m_key_equal;
+	Allocator                       m_allocator;
+	Pointer                         m_slots = nullptr;
+	Distances                       m_distances;
+	std::size_t                     m_size     = 0;
+	std::size_t                     m_capacity = 0;
+	int                             m_shift    = 0;
+
+	static constexpr std::size_t capacity_for(std::size_t count) {
+		if (count == 0)
+		{
+			return 0;
+		}
+		return std::max(minimum_capacity, std::bit_ceil(count + (count + 6) / 7));
+	}
+
+	static constexpr std::size_t max_size_for(std::size_t capacity) {
+		return capacity / 8 * 7;
+	}
+
+	Pointer allocate_slots(std::size_t capacity) {
+		return capacity == 0 ? nullptr : Alloc_Traits::allocate(m_allocator, capacity);
+	}
+
+	[[nodiscard]] std::size_t home(Key const &key) const {
+		return detail::mixed_index(detail::fibonacci_mix(m_hash(key)), m_shift);
+	}
+
+	[[nodiscard]] std::size_t next_slot(std::size_t index) const {
+		return (index + 1) & (m_capacity - 1);
+	}
+
+	[[nodiscard]] std::size_t previous_slot(std::size_t index) const {
+		return (index - 1) & (m_capacity - 1);
+	}
+
+	[[nodiscard]] std::size_t next_occupied(std::size_t index) const {
+		while (index < m_capacity && m_distances[index] == 0)
+		{
+			++index;
+		}
+		return index;
+	}
+
+	[[nodiscard]] Probe find_probe(Key const &key) const {
+		if (m_size == 0)
+		{
+			return {0, false};
+		}
+
+		std::size_t index    = home(key);
+		Distance    distance = 1;
+		while (distance <= m_distances[index])
+		{
+			bool const same_home = distance == m_distances[index];
+			if (same_home && m_key_equal(Key_Of{}(m_slots[index]), key))
+			{
+				return {index, true};
+			}
+			index = next_slot(index);
+			++distance;
+		}
+		return {index, false};
+	}
+
+	/**
+	 * @brief Inserts an element whose key is not in the table, which must have
+	 * an empty slot, after the elements sharing its home or with an earlier
+	 * home, shifting the rest of the run forward by one
+	 * @return The slot of the element
+	 */
+	std::size_t place(Value &&value) {
+		std::size_t index    = home(Key_Of{}(value));
+		Distance    distance = 1;
+		while (distance <= m_distances[index])
+		{
+			index = next_slot(index);
+			++distance;
+		}
+
+		std::size_t empty = index;
+		while (m_distances[empty] != 0)
+		{
+			empty = next_slot(empty);
+		}
+
+		if (empty == index)
+		{
+			Alloc_Traits::construct(m_allocator, m_slots + index, std::move(value));
+		}
+		else
+		{
+			std::size_t previous = previous_slot(empty);
+			Alloc_Traits::construct(
+			    m_allocator,
+			    m_slots + empty,
+			    std::move(m_slots[previous]));
+			m_distances[empty] = m_distances[previous] + 1;
+
+			for (std::size_t slot = previous; slot != index; slot = previous)
+			{
+				previous          = previous_slot(slot);
+				m_slots[slot]     = std::move(m_slots[previous]);
+				m_distances[slot] = m_distances[previous] + 1;
+			}
+			m_slots[index] = std::move(value);
+		}
+
+		m_distances[index] = distance;
+		++m_size;
+		return index;
+	}
+
+	void rehash(std::size_t capacity) {
+		Pointer const     slots         = m_slots;
+		Distances const   distances     = std::move(m_distances);
+		std::size_t const previous_size = m_capacity;
+
+		m_slots     = allocate_slots(capacity);
+		m_distances = Distances(capacity, 0, typename Distances::Allocator(m_allocator));
+		m_size      = 0;
+		m_capacity  = capacity;
+		m_shift     = 64 - std::countr_zero(capacity);
+
+		for (std::size_t index = 0; index < previous_size; ++index)
+		{
+			if (distances[index] != 0)
+			{
+				place(std::move(slots[index]));
+				Alloc_Traits::destroy(m_allocator, slots + index);
+			}
+		}
+
+		if (slots != nullptr)
+		{
+			Alloc_Traits::deallocate(m_allocator, slots, previous_size);
+		}
+	}
+};
+
+} // namespace detail
+
+} // namespace dsa
+
+#endif
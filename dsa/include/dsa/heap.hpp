@@ -6,6 +6,9 @@
 #include <dsa/vector.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
 
 namespace dsa
 {
@@ -15,19 +18,53 @@ namespace dsa
  * such a way as to allow fast access to the greatest element. The heap ensures
  * that the property comparator(root, child) holds for each element
  *
+ * Each element has Arity children, so a wider heap is shallower and a sift
+ * down compares children which sit next to each other in memory, at the cost
+ * of more comparisons per level.
+ *
+ * An Indexed heap gives every pushed element a Handle through which it can
+ * later be updated or erased. It keeps the position of each handle up to date
+ * as elements move, which costs two more arrays and their updates on every
+ * swap, so plain heaps do not track handles.
+ *
  * @ingroup containers
  *
  * @tparam Value_t: The type of element to store
  * @tparam Comparator_t: The type of a comparator for which comparator(x,y)
  * holds
  * @tparam Allocator_Base: The type of allocator used for memory management
+ * @tparam Arity: The number of children of each element
+ * @tparam Indexed: Whether elements can be updated and erased through handles
  *
  */
-template<typename Value_t, typename Comparator_t = decltype(std::less{}), typename Allocator_t = Default_Allocator<Value_t>>
+template<
+    typename Value_t,
+    typename Comparator_t = decltype(std::less{}),
+    typename Allocator_t  = Default_Allocator<Value_t>,
+    std::size_t Arity     = 2,
+    bool Indexed          = false>
 class Heap
 {
+	static_assert(Arity >= 2, "Each element needs at least two children to form a heap");
+
  private:
-	using Storage = dsa::Vector<Value_t, Allocator_t>;
+	using Storage         = dsa::Vector<Value_t, Allocator_t>;
+	using Index_Allocator = typename Allocator_t::template rebind<std::size_t>;
+	using Index_Storage   = dsa::Vector<std::size_t, Index_Allocator>;
+
+	static constexpr std::size_t no_handle = std::numeric_limits<std::size_t>::max();
+
+	// The handle of the element at each position, and the position of each
+	// handle. Released handles instead link to the next released handle
+	struct Handle_Index
+	{
+		Index_Storage m_handles;
+		Index_Storage m_positions;
+		std::size_t   m_free_handle = no_handle;
+	};
+
+	struct No_Handle_Index
+	{};
 
  public:
 	using Comparator      = Comparator_t;
@@ -38,6 +75,24 @@ class Heap
 	using Pointer         = typename Storage::Pointer;
 	using Const_Pointer   = typename Storage::Const_Pointer;
 
+	/**
+	 * @brief Refers to an element pushed into the heap until it is popped or
+	 * erased, after which it may be given to another element
+	 */
+	class Handle
+	{
+	 public:
+		bool operator==(Handle const &handle) const = default;
+
+	 private:
+		friend Heap;
+
+		explicit Handle(std::size_t id) : m_id(id) {
+		}
+
+		std::size_t m_id;
+	};
+
 	/**
 	 * @brief Constructs an empty heap
 	 */
@@ -49,6 +104,11 @@ class Heap
 	Heap(std::initializer_list<Value_t> list, Comparator comparator = std::less{})
 	    : m_comparator(std::move(comparator)) {
 		m_storage.reserve(list.size());
+		if constexpr (Indexed)
+		{
+			m_index.m_handles.reserve(list.size());
+			m_index.m_positions.reserve(list.size());
+		}
 		for (auto const &value : list)
 		{
 			push(value);
@@ -59,6 +119,19 @@ class Heap
 		using std::swap;
 		swap(lhs.m_storage, rhs.m_storage);
 		swap(lhs.m_comparator, rhs.m_comparator);
+		if constexpr (Indexed)
+		{
+			swap(lhs.m_index.m_handles, rhs.m_index.m_handles);
+			swap(lhs.m_index.m_positions, rhs.m_index.m_positions);
+			swap(lhs.m_index.m_free_handle, rhs.m_index.m_free_handle);
+		}
+	}
+
+	/**
+	 * @brief Returns the number of children of each element
+	 */
+	[[nodiscard]] static constexpr std::size_t arity() {
+		return Arity;
 	}
 
 	/**
@@ -77,7 +150,8 @@ class Heap
 
 	/**
 	 * @brief Returns a reference to the underlying container storing the
-	 * heap
+	 * heap. Moving elements around through it leaves the handles referring
+	 * to the wrong elements
 	 */
 	[[nodiscard]] Storage &storage() {
 		return m_storage;
@@ -107,23 +181,42 @@ class Heap
 		return m_storage[0];
 	}
 
+	/**
+	 * @brief Returns a const reference to the element the handle refers to
+	 */
+	[[nodiscard]] Value const &value(Handle handle) const
+	    requires Indexed
+	{
+		return m_storage[position_of(handle.m_id)];
+	}
+
 	/**
 	 * @brief Adds an element to the heap and does the work necessary to
 	 * maintain the heap property
 	 */
-	void push(Value value) {
-		using std::swap;
+	void push(Value value)
+	    requires(!Indexed)
+	{
+		m_storage.append(std::move(value));
+		sift_up(m_storage.size() - 1);
+	}
 
-		std::size_t index = m_storage.size();
+	/**
+	 * @brief Adds an element to the heap and does the work necessary to
+	 * maintain the heap property
+	 * @return A handle through which the element can be updated or erased
+	 */
+	Handle push(Value value)
+	    requires Indexed
+	{
+		std::size_t const id       = acquire_handle();
+		std::size_t const position = m_storage.size();
 		m_storage.append(std::move(value));
+		m_index.m_handles.append(id);
+		m_index.m_positions[id] = position;
 
-		for (std::size_t parent = parent_index(index);
-		     index != 0 && !m_comparator(m_storage[parent], m_storage[index]);
-		     parent = parent_index(index))
-		{
-			swap(m_storage[parent], m_storage[index]);
-			index = parent;
-		}
+		sift_up(position);
+		return Handle(id);
 	}
 
 	/**
@@ -132,33 +225,129 @@ class Heap
 	 * if the heap is empty
 	 */
 	void pop() {
+		erase_at(0);
+	}
+
+	/**
+	 * @brief Replaces the element the handle refers to with the given value
+	 * and moves it up or down to maintain the heap property
+	 */
+	void update(Handle handle, Value value)
+	    requires Indexed
+	{
+		std::size_t const position = position_of(handle.m_id);
+		m_storage[position]        = std::move(value);
+		restore(position);
+	}
+
+	/**
+	 * @brief Removes the element the handle refers to and does the work
+	 * necessary to maintain the heap property
+	 */
+	void erase(Handle handle)
+	    requires Indexed
+	{
+		erase_at(position_of(handle.m_id));
+	}
+
+ private:
+	using Index = std::conditional_t<Indexed, Handle_Index, No_Handle_Index>;
+
+	Storage                     m_storage;
+	Comparator                  m_comparator;
+	[[no_unique_address]] Index m_index;
+
+	/**
+	 * @brief Returns the index of the parent given an index of one of the
+	 * children.
+	 */
+	[[nodiscard]] std::size_t parent_index(std::size_t index) const {
+		return (index - 1) / Arity;
+	}
+
+	/**
+	 * @brief Returns the index of the first child given an index of the
+	 * parent
+	 */
+	[[nodiscard]] std::size_t child_index(std::size_t index) const {
+		return (index * Arity) + 1;
+	}
+
+	[[nodiscard]] std::size_t position_of(std::size_t id) const {
+		return m_index.m_positions[id];
+	}
+
+	[[nodiscard]] std::size_t handle_at(std::size_t position) const {
+		return m_index.m_handles[position];
+	}
+
+	/**
+	 * @brief Returns an unused handle, reusing a released one if possible
+	 */
+	[[nodiscard]] std::size_t acquire_handle() {
+		if (m_index.m_free_handle == no_handle)
+		{
+			m_index.m_positions.append(no_handle);
+			return m_index.m_positions.size() - 1;
+		}
+
+		std::size_t const id  = m_index.m_free_handle;
+		m_index.m_free_handle = position_of(id);
+		return id;
+	}
+
+	void release_handle(std::size_t id) {
+		m_index.m_positions[id] = m_index.m_free_handle;
+		m_index.m_free_handle   = id;
+	}
+
+	/**
+	 * @brief Swaps the elements at both positions, along with their handles
+	 * if the heap is indexed
+	 */
+	void swap_elements(std::size_t lhs, std::size_t rhs) {
 		using std::swap;
 
-		if (size() == 1)
+		swap(m_storage[lhs], m_storage[rhs]);
+		if constexpr (Indexed)
 		{
-			m_storage.clear();
-			return;
+			swap(m_index.m_handles[lhs], m_index.m_handles[rhs]);
+			m_index.m_positions[handle_at(lhs)] = lhs;
+			m_index.m_positions[handle_at(rhs)] = rhs;
 		}
+	}
 
-		const std::size_t last = m_storage.size() - 1;
-		swap(m_storage[0], m_storage[last]);
-		m_storage.erase(last);
+	/**
+	 * @brief Moves the element at index up while it compares before its
+	 * parent
+	 */
+	void sift_up(std::size_t index) {
+		for (std::size_t parent = parent_index(index);
+		     index != 0 && m_comparator(m_storage[index], m_storage[parent]);
+		     parent = parent_index(index))
+		{
+			swap_elements(parent, index);
+			index = parent;
+		}
+	}
 
-		std::size_t parent = 0;
-		for (std::size_t left = 1; left < m_storage.size(); left = child_index(parent))
+	/**
+	 * @brief Moves the element at index down while any of its children
+	 * compares before it
+	 */
+	void sift_down(std::size_t parent) {
+		for (std::size_t first = child_index(parent); first < m_storage.size();
+		     first             = child_index(parent))
 		{
-			const std::size_t right = left + 1;
+			std::size_t const last = std::min(first + Arity, m_storage.size());
 
 			std::size_t smallest = parent;
-			if (m_comparator(m_storage[left], m_storage[parent]))
-			{
-				smallest = left;
-			}
-
-			if (right < m_storage.size()
-			    && m_comparator(m_storage[right], m_storage[smallest]))
+			for (std::size_t child = first; child < last; ++child)
 			{
-				smallest = right;
+				if (m_comparator(m_storage[child], m_storage[smallest]))
+				{
+					smallest = child;
+				}
 			}
 
 			if (smallest == parent)
@@ -166,32 +355,61 @@ class Heap
 				break;
 			}
 
-			swap(m_storage[parent], m_storage[smallest]);
+			swap_elements(parent, smallest);
 			parent = smallest;
 		}
 	}
 
- private:
-	Storage    m_storage;
-	Comparator m_comparator;
-
 	/**
-	 * @brief Returns the index of the parent given an index of one of the
-	 * children.
+	 * @brief Replaces the element at the given position with the last one
+	 * and moves that up or down to maintain the heap property
 	 */
-	[[nodiscard]] std::size_t parent_index(std::size_t index) const {
-		return (index - 1) / 2;
+	void erase_at(std::size_t position) {
+		std::size_t const last = m_storage.size() - 1;
+		if (position != last)
+		{
+			swap_elements(position, last);
+		}
+		m_storage.erase(last);
+		if constexpr (Indexed)
+		{
+			release_handle(handle_at(last));
+			m_index.m_handles.erase(last);
+		}
+
+		if (position != last)
+		{
+			restore(position);
+		}
 	}
 
 	/**
-	 * @brief Returns the index of the first child given an index of the
-	 * parent
+	 * @brief Moves the element at the given position up or down, whichever
+	 * the heap property requires after it changed
 	 */
-	[[nodiscard]] std::size_t child_index(std::size_t index) const {
-		return (index * 2) + 1;
+	void restore(std::size_t position) {
+		if (position != 0 && m_comparator(m_storage[position], m_storage[parent_index(position)]))
+		{
+			sift_up(position);
+		}
+		else
+		{
+			sift_down(position);
+		}
 	}
 };
 
+/**
+ * @brief A heap whose elements can be updated and erased through the handles
+ * returned when they are pushed
+ */
+template<
+    typename Value_t,
+    typename Comparator_t = decltype(std::less{}),
+    typename Allocator_t  = Default_Allocator<Value_t>,
+    std::size_t Arity     = 2>
+using Indexed_Heap = Heap<Value_t, Comparator_t, Allocator_t, Arity, true>;
+
 } // namespace dsa
 
 #endif
@@ -5,12 +5,19 @@
 #include <dsa/default_allocator.hpp>
 #include <dsa/node.hpp>
 
+#include <algorithm>
+#include <cassert>
 #include <cstddef>
+#include <initializer_list>
 #include <memory>
+#include <utility>
 
 namespace dsa
 {
 
+template<typename Value_t, typename Allocator_t>
+class List;
+
 namespace detail
 {
 
@@ -53,10 +60,9 @@ class List_Node
 		explicit Iterator_Detail(Node_Pointer node) : m_node(node) {
 		}
 
-		Iterator_Detail operator++() {
+		Iterator_Detail &operator++() {
 			m_node = m_node->m_next;
-			Iterator_Detail iterator(m_node);
-			return iterator;
+			return *this;
 		}
 
 		auto operator<=>(Iterator_Detail const &iterator) const -> bool = default;
@@ -70,6 +76,8 @@ class List_Node
 		}
 
 	 private:
+		friend List<Satellite_t, Allocator_t>;
+
 		Node_Pointer m_node;
 	};
 
@@ -93,10 +101,10 @@ class List_Node
 
 } // namespace detail
 
-// ToDo: Use iterators to make insertion/ deletion constant time
-
 /**
  * @brief Holds a set of non contigious elements in a singly linked list.
+ * The list keeps its size and last node, so appending and splicing whole
+ * lists are constant time, as are insertion and erasure after an iterator
  *
  * @ingroup containers
  *
@@ -138,11 +146,9 @@ class List
 	 */
 	List(std::initializer_list<Value_t> values, Allocator const &allocator = Allocator())
 	    : m_allocator(allocator) {
-		Node_Pointer *owner = &m_head;
 		for (auto const &value : values)
 		{
-			*owner = create_node(value);
-			owner  = &(*owner)->m_next;
+			append(value);
 		}
 	}
 
@@ -151,12 +157,9 @@ class List
 	}
 
 	List(List const &list) : m_allocator(list.m_allocator) {
-		Node_Pointer *owner = &m_head;
-		for (auto const &iterator : list)
+		for (auto const &value : list)
 		{
-			Node_Pointer node = create_node(iterator);
-			*owner            = node;
-			owner             = &node->m_next;
+			append(value);
 		}
 	}
 
@@ -164,12 +167,15 @@ class List
 		using std::swap;
 		swap(lhs.m_allocator, rhs.m_allocator);
 		swap(lhs.m_head, rhs.m_head);
+		swap(lhs.m_tail, rhs.m_tail);
+		swap(lhs.m_size, rhs.m_size);
 	}
 
 	List(List &&list) noexcept
 	    : m_allocator(std::move(list.m_allocator))
-	    , m_head(std::move(list.m_head)) {
-		list.m_head = nullptr;
+	    , m_head(std::exchange(list.m_head, nullptr))
+	    , m_tail(std::exchange(list.m_tail, nullptr))
+	    , m_size(std::exchange(list.m_size, 0)) {
 	}
 
 	auto operator=(List list) noexcept -> List & {
@@ -194,16 +200,10 @@ class List
 	}
 
 	/**
-	 * @brief Gets the number of elements currently in the list.
-	 * Note: This operation is not constant as the size is not cached
+	 * @brief Gets the number of elements currently in the list
 	 */
 	[[nodiscard]] auto size() const -> std::size_t {
-		size_t list_size = 0;
-		for ([[maybe_unused]] auto const &iterator : *this)
-		{
-			list_size++;
-		}
-		return list_size;
+		return m_size;
 	}
 
 	/**
@@ -222,6 +222,22 @@ class List
 		return m_head->m_satellite;
 	}
 
+	/**
+	 * @brief Gets the last element in the list. This is undefined
+	 * behaviour if the list is empty
+	 */
+	[[nodiscard]] auto back() -> Reference {
+		return m_tail->m_satellite;
+	}
+
+	/**
+	 * @brief Gets the last element in the list. This is undefined
+	 * behaviour if the list is empty
+	 */
+	[[nodiscard]] auto back() const -> Const_Reference {
+		return m_tail->m_satellite;
+	}
+
 	/**
 	 * @brief Returns true if the list contains no elements
 	 */
@@ -241,13 +257,33 @@ class List
 			node = next;
 		}
 		m_head = nullptr;
+		m_tail = nullptr;
+		m_size = 0;
 	}
 
 	/**
 	 * @brief Inserts the given value at the front of the list
 	 */
 	void prepend(Value_t value) {
-		insert(0, std::move(value));
+		link_after(nullptr, create_node(std::move(value)));
+	}
+
+	/**
+	 * @brief Inserts the given value at the back of the list
+	 */
+	void append(Value_t value) {
+		emplace_back(std::move(value));
+	}
+
+	/**
+	 * @brief Constructs a value at the back of the list from the given
+	 * arguments, directly inside of its node
+	 */
+	template<typename... Arguments>
+	auto emplace_back(Arguments &&...arguments) -> Reference {
+		Node_Pointer node = create_node(std::forward<Arguments>(arguments)...);
+		link_after(m_tail, node);
+		return node->m_satellite;
 	}
 
 	/**
@@ -255,11 +291,41 @@ class List
 	 * undefined if the index is outside of the range: [0, size()]
 	 */
 	void insert(std::size_t index, Value_t value) {
-		Node_Pointer node = create_node(std::move(value));
+		emplace(index, std::move(value));
+	}
 
-		Node_Pointer *owner = at(index);
-		node->m_next        = *owner;
-		*owner              = node;
+	/**
+	 * @brief Constructs a value at the given index from the given
+	 * arguments, directly inside of its node. The behaviour is undefined if
+	 * the index is outside of the range: [0, size()]
+	 */
+	template<typename... Arguments>
+	auto emplace(std::size_t index, Arguments &&...arguments) -> Reference {
+		Node_Pointer node = create_node(std::forward<Arguments>(arguments)...);
+		link_after(node_before(index), node);
+		return node->m_satellite;
+	}
+
+	/**
+	 * @brief Inserts the given value after the element at position. The
+	 * behaviour is undefined if position is the end of the list
+	 * @return An iterator to the inserted element
+	 */
+	auto insert_after(Iterator position, Value_t value) -> Iterator {
+		return emplace_after(position, std::move(value));
+	}
+
+	/**
+	 * @brief Constructs a value after the element at position from the
+	 * given arguments, directly inside of its node. The behaviour is
+	 * undefined if position is the end of the list
+	 * @return An iterator to the constructed element
+	 */
+	template<typename... Arguments>
+	auto emplace_after(Iterator position, Arguments &&...arguments) -> Iterator {
+		Node_Pointer node = create_node(std::forward<Arguments>(arguments)...);
+		link_after(position.m_node, node);
+		return Iterator(node);
 	}
 
 	/**
@@ -267,7 +333,7 @@ class List
 	 * undefined if the list is empty
 	 */
 	void detatch_front() {
-		erase(0);
+		unlink_after(nullptr);
 	}
 
 	/**
@@ -275,14 +341,40 @@ class List
 	 * undefined if the index is outside of the list size.
 	 */
 	void erase(std::size_t index) {
-		Node_Pointer *owner  = at(index);
-		Node_Pointer  remove = *owner;
-		*owner               = remove->m_next;
-		destroy_node(remove);
+		unlink_after(node_before(index));
+	}
+
+	/**
+	 * @brief Erases the element after the one at position. The behaviour
+	 * is undefined if there is no such element
+	 * @return An iterator to the element after the erased one
+	 */
+	auto erase_after(Iterator position) -> Iterator {
+		unlink_after(position.m_node);
+		return Iterator(position.m_node->m_next);
+	}
+
+	/**
+	 * @brief Moves every element of the other list after the element at
+	 * position, without copying or allocating. The behaviour is undefined
+	 * if position is the end of the list. The allocators of the lists must
+	 * be able to free each other's memory
+	 */
+	void splice_after(Iterator position, List &list) {
+		splice_after(position.m_node, list);
+	}
+
+	/**
+	 * @brief Moves every element of the other list to the back of this
+	 * one, without copying or allocating. The allocators of the lists must
+	 * be able to free each other's memory
+	 */
+	void splice_back(List &list) {
+		splice_after(m_tail, list);
 	}
 
 	friend bool operator==(List const &lhs, List const &rhs) noexcept {
-		return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+		return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
 	}
 
 	friend bool operator!=(List const &lhs, List const &rhs) noexcept {
@@ -292,6 +384,8 @@ class List
  private:
 	Node_Allocator m_allocator;
 	Node_Pointer   m_head = nullptr;
+	Node_Pointer   m_tail = nullptr;
+	std::size_t    m_size = 0;
 
 	template<typename... Arguments>
 	auto create_node(Arguments &&...arguments) -> Node_Pointer {
@@ -306,16 +400,78 @@ class List
 	}
 
 	/**
-	 * @brief Gets the node at the given index. The behaviour is undefined
-	 * if the index is outside of the list range
+	 * @brief Gets the link to the node after previous, where a null
+	 * previous stands for the position before the first node
+	 */
+	auto next_of(Node_Pointer previous) -> Node_Pointer & {
+		return previous == nullptr ? m_head : previous->m_next;
+	}
+
+	/**
+	 * @brief Gets the node before the given index, or null for the first
+	 * index. The last node is known, so the index after it is found in
+	 * constant time. The behaviour is undefined if the index is outside of
+	 * the range: [0, size()]
 	 */
-	auto at(std::size_t index) -> Node_Pointer * {
-		Node_Pointer *node = &m_head;
+	auto node_before(std::size_t index) -> Node_Pointer {
+		if (index == m_size)
+		{
+			return m_tail;
+		}
+
+		Node_Pointer previous = nullptr;
 		for (std::size_t i = 0; i < index; ++i)
 		{
-			node = &(*node)->m_next;
+			previous = next_of(previous);
 		}
-		return node;
+		return previous;
+	}
+
+	void link_after(Node_Pointer previous, Node_Pointer node) {
+		Node_Pointer &next = next_of(previous);
+		node->m_next       = next;
+		next               = node;
+		if (previous == m_tail)
+		{
+			m_tail = node;
+		}
+		++m_size;
+	}
+
+	void unlink_after(Node_Pointer previous) {
+		Node_Pointer &next   = next_of(previous);
+		Node_Pointer  remove = next;
+		next                 = remove->m_next;
+		if (remove == m_tail)
+		{
+			m_tail = previous;
+		}
+		--m_size;
+		destroy_node(remove);
+	}
+
+	void splice_after(Node_Pointer previous, List &list) {
+		assert(
+		    Node_Traits::equal(m_allocator, list.m_allocator)
+		    && "Lists can only be spliced if their allocators can free each other's memory");
+
+		if (list.empty())
+		{
+			return;
+		}
+
+		Node_Pointer &next   = next_of(previous);
+		list.m_tail->m_next  = next;
+		next                 = list.m_head;
+		if (previous == m_tail)
+		{
+			m_tail = list.m_tail;
+		}
+		m_size += list.m_size;
+
+		list.m_head = nullptr;
+		list.m_tail = nullptr;
+		list.m_size = 0;
 	}
 };
 
@@ -1,10 +1,15 @@
 #ifndef DSA_MEMORY_HPP
 #define DSA_MEMORY_HPP
 
+#include <dsa/type_traits.hpp>
+
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <memory>
+#include <type_traits>
 
 namespace dsa
 {
@@ -12,11 +17,42 @@ namespace dsa
 namespace detail
 {
 
+/// @brief The size of the cache lines which positions shared between threads
+/// are spread over, so that threads updating one do not invalidate the other
+inline constexpr std::size_t cache_line_size = 64;
+
+/**
+ * @brief Relocation can be done with a single memmove when the iterator is a
+ * raw pointer to a trivially relocatable type. Fancy pointers, such as the ones
+ * used by the Memory_Monitor, always take the element by element path so that
+ * every move and destruction remains observable.
+ */
+template<class Iterator>
+constexpr bool Is_Bitwise_Relocatable =
+    std::is_pointer_v<Iterator> && Is_Trivially_Relocatable_v<std::iter_value_t<Iterator>>;
+
+template<class Pointer>
+void bitwise_relocate(Pointer begin, Pointer end, Pointer destination) {
+	if (begin == end)
+	{
+		return;
+	}
+
+	using Value = std::iter_value_t<Pointer>;
+
+	auto const count = static_cast<std::size_t>(end - begin);
+	std::memmove(
+	    static_cast<void *>(destination),
+	    static_cast<void const *>(begin),
+	    count * sizeof(Value));
+}
+
 template<class Iterator>
-void overlapping_uninitialized_move(Iterator begin, Iterator end, Iterator destination) {
-	while (begin != end)
+void overlapping_uninitialized_relocate(Iterator begin, Iterator end, Iterator destination) {
+	for (; begin != end; ++begin, ++destination)
 	{
-		std::uninitialized_move_n(begin++, 1, destination++);
+		std::uninitialized_move_n(begin, 1, destination);
+		std::destroy_at(std::addressof(*begin));
 	}
 }
 
@@ -40,22 +76,33 @@ bool iterators_overlap(Iterator begin, Iterator end, Iterator destination) {
 }
 
 /**
- * @brief shifts [begin, end) into [begin + 1, end + 1). Where end points to
- * uninitialized memory.
+ * @brief shifts [begin, end) into [begin + count, end + count). Where the
+ * elements outside of [begin, end) in the destination range point to
+ * uninitialized memory. The vacated elements are destroyed, so after the call
+ * only the destination range holds initialised values.
  */
 template<class Iterator>
-void uninitialized_shift(Iterator begin, Iterator end, int count = 1) {
+constexpr void uninitialized_shift(Iterator begin, Iterator end, std::ptrdiff_t count = 1) {
 	assert(count != 0 && "Elements must be moved into uninitialized memory");
+	if constexpr (detail::Is_Bitwise_Relocatable<Iterator>)
+	{
+		if (!std::is_constant_evaluated())
+		{
+			detail::bitwise_relocate(begin, end, begin + count);
+			return;
+		}
+	}
+
 	if (count > 0)
 	{
-		detail::overlapping_uninitialized_move(
+		detail::overlapping_uninitialized_relocate(
 		    std::reverse_iterator(end),
 		    std::reverse_iterator(begin),
 		    std::reverse_iterator(end + count));
 	}
 	else
 	{
-		detail::overlapping_uninitialized_move(begin, end, begin + count);
+		detail::overlapping_uninitialized_relocate(begin, end, begin + count);
 	}
 }
 
@@ -73,6 +120,33 @@ void uninitialized_move(Iterator begin, Iterator end, Iterator destination) {
 	std::uninitialized_move(begin, end, destination);
 }
 
+/**
+ * @brief Moves the range [begin, end) into the uninitialized memory at
+ * destination and ends the lifetime of the source elements. Trivially
+ * relocatable values held behind raw pointers are copied with a single
+ * memmove.
+ *
+ * Note: The ranges must not overlap, use uninitialized_shift in such cases.
+ */
+template<class Iterator>
+constexpr void uninitialized_relocate(Iterator begin, Iterator end, Iterator destination) {
+	assert(
+	    !iterators_overlap(begin, end, destination)
+	    && "Relocation is undefined if the source and destination ranges overlap");
+
+	if constexpr (detail::Is_Bitwise_Relocatable<Iterator>)
+	{
+		if (!std::is_constant_evaluated())
+		{
+			detail::bitwise_relocate(begin, end, destination);
+			return;
+		}
+	}
+
+	std::uninitialized_move(begin, end, destination);
+	std::destroy(begin, end);
+}
+
 } // namespace dsa
 
 #endif
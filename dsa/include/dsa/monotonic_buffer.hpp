@@ -0,0 +1,195 @@
+#ifndef DSA_MONOTONIC_BUFFER_HPP
+#define DSA_MONOTONIC_BUFFER_HPP
+
+#include <dsa/allocator_traits.hpp>
+#include <dsa/default_allocator.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace dsa
+{
+
+/**
+ * @brief Hands out memory by bumping a pointer through large chunks requested
+ * from an upstream allocator. Memory is only given back all at once with
+ * reset, except for the most recent allocation which may be released or
+ * expanded in place. This makes the buffer a good fit for scratch space whose
+ * allocations are freed in the reverse order in which they were made, such as
+ * the temporaries of recursive algorithms.
+ *
+ * The buffer is neither copyable nor movable since Arena_Allocators refer to
+ * it by address.
+ *
+ * @tparam Allocator_t: The upstream allocator used to request chunks
+ */
+template<typename Allocator_t = Default_Allocator<std::byte>>
+class Monotonic_Buffer
+{
+ private:
+	using Alloc_Traits = Allocator_Traits<typename Allocator_t::template rebind<std::byte>>;
+	using Pointer      = typename Alloc_Traits::Pointer;
+
+	static_assert(
+	    std::is_same_v<Pointer, std::byte *>,
+	    "The upstream allocator must hand out raw memory");
+
+ public:
+	using Allocator = typename Alloc_Traits::Allocator;
+
+	/**
+	 * @brief Constructs a buffer which allocates a chunk of the given
+	 * number of bytes up front
+	 */
+	explicit Monotonic_Buffer(std::size_t initial_size = 0, Allocator allocator = Allocator())
+	    : m_allocator(std::move(allocator)) {
+		if (initial_size != 0)
+		{
+			add_chunk(initial_size);
+		}
+	}
+
+	~Monotonic_Buffer() {
+		release();
+	}
+
+	Monotonic_Buffer(Monotonic_Buffer const &)            = delete;
+	Monotonic_Buffer &operator=(Monotonic_Buffer const &) = delete;
+	Monotonic_Buffer(Monotonic_Buffer &&)                 = delete;
+	Monotonic_Buffer &operator=(Monotonic_Buffer &&)      = delete;
+
+	/**
+	 * @brief Returns the number of bytes held by all chunks
+	 */
+	[[nodiscard]] std::size_t capacity() const {
+		return m_capacity;
+	}
+
+	/**
+	 * @brief Returns memory for the given number of bytes aligned to the
+	 * given power of two. A new chunk, at least as large as every previous
+	 * chunk combined, is requested when the current one is exhausted
+	 */
+	[[nodiscard]] void *allocate(std::size_t bytes, std::size_t alignment) {
+		assert(std::has_single_bit(alignment) && "Alignment must be a power of two");
+
+		std::byte *pointer = aligned_top(alignment);
+		if (m_top == nullptr || pointer > m_end
+		    || bytes > static_cast<std::size_t>(m_end - pointer))
+		{
+			add_chunk(std::max(bytes + alignment, m_capacity));
+			pointer = aligned_top(alignment);
+		}
+
+		m_top = pointer + bytes;
+		return pointer;
+	}
+
+	/**
+	 * @brief Releases the given allocation if it is the most recent one,
+	 * otherwise its memory is kept until the buffer is reset
+	 */
+	void deallocate(void *pointer, std::size_t bytes) {
+		if (is_top(pointer, bytes))
+		{
+			m_top = static_cast<std::byte *>(pointer);
+		}
+	}
+
+	/**
+	 * @brief Grows the given allocation in place, which is only possible
+	 * for the most recent allocation while its chunk has space left
+	 */
+	bool expand_in_place(void *pointer, std::size_t bytes, std::size_t new_bytes) {
+		auto *const begin = static_cast<std::byte *>(pointer);
+		if (!is_top(pointer, bytes) || new_bytes > static_cast<std::size_t>(m_end - begin))
+		{
+			return false;
+		}
+
+		m_top = begin + new_bytes;
+		return true;
+	}
+
+	/**
+	 * @brief Releases every allocation at once. If more than one chunk was
+	 * needed they are merged into a single chunk, so that repeating the
+	 * same work does not need to request memory again
+	 */
+	void reset() {
+		if (m_chunk == nullptr)
+		{
+			return;
+		}
+
+		if (m_chunk->m_previous != nullptr)
+		{
+			std::size_t const capacity = m_capacity;
+			release();
+			add_chunk(capacity);
+			return;
+		}
+
+		m_top = data(m_chunk);
+	}
+
+ private:
+	struct alignas(std::max_align_t) Chunk
+	{
+		Chunk      *m_previous;
+		std::size_t m_size;
+	};
+
+	Allocator   m_allocator;
+	Chunk      *m_chunk    = nullptr;
+	std::byte  *m_top      = nullptr;
+	std::byte  *m_end      = nullptr;
+	std::size_t m_capacity = 0;
+
+	static std::byte *data(Chunk *chunk) {
+		return reinterpret_cast<std::byte *>(chunk + 1);
+	}
+
+	[[nodiscard]] std::byte *aligned_top(std::size_t alignment) const {
+		auto const address = reinterpret_cast<std::uintptr_t>(m_top);
+		auto const aligned = (address + alignment - 1) & ~(std::uintptr_t{alignment} - 1);
+		return m_top + (aligned - address);
+	}
+
+	[[nodiscard]] bool is_top(void *pointer, std::size_t bytes) const {
+		return pointer != nullptr && static_cast<std::byte *>(pointer) + bytes == m_top;
+	}
+
+	void add_chunk(std::size_t size) {
+		std::byte *memory = Alloc_Traits::allocate(m_allocator, sizeof(Chunk) + size);
+		m_chunk           = ::new (static_cast<void *>(memory)) Chunk{m_chunk, size};
+		m_top             = data(m_chunk);
+		m_end             = m_top + size;
+		m_capacity += size;
+	}
+
+	void release() {
+		while (m_chunk != nullptr)
+		{
+			Chunk *previous = m_chunk->m_previous;
+			Alloc_Traits::deallocate(
+			    m_allocator,
+			    reinterpret_cast<std::byte *>(m_chunk),
+			    sizeof(Chunk) + m_chunk->m_size);
+			m_chunk = previous;
+		}
+		m_top      = nullptr;
+		m_end      = nullptr;
+		m_capacity = 0;
+	}
+};
+
+} // namespace dsa
+
+#endif
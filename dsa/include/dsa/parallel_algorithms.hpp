@@ -0,0 +1,309 @@
+#ifndef DSA_PARALLEL_ALGORITHMS_HPP
+#define DSA_PARALLEL_ALGORITHMS_HPP
+
+#include <dsa/algorithms.hpp>
+#include <dsa/default_allocator.hpp>
+#include <dsa/dynamic_array.hpp>
+#include <dsa/work_stealing_pool.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+
+namespace dsa
+{
+
+/**
+ * @brief Ranges of up to this many elements are not split any further by the
+ * parallel algorithms, which run the sequential algorithm on them instead
+ */
+constexpr std::size_t parallel_grain_size = 16'384;
+
+namespace detail
+{
+
+/**
+ * @brief Moves [begin, end) into destination, splitting the work across the
+ * pool above the grain size
+ */
+template<typename Iterator, typename Output>
+void parallel_move(
+    Work_Stealing_Pool &pool,
+    Iterator            begin,
+    Iterator            end,
+    Output              destination,
+    std::size_t         grain_size) {
+	auto const size = end - begin;
+	if (static_cast<std::size_t>(size) <= grain_size)
+	{
+		std::move(begin, end, destination);
+		return;
+	}
+
+	auto const half = size / 2;
+	pool.invoke(
+	    [&] { parallel_move(pool, begin, begin + half, destination, grain_size); },
+	    [&] { parallel_move(pool, begin + half, end, destination + half, grain_size); });
+}
+
+/**
+ * @brief Merges the sorted runs [first, first_end) and [second, second_end)
+ * into destination. Large merges move the middle element of the longer run
+ * straight to its final position, which is found with a binary search in the
+ * other run, and merge both sides of it in parallel. Equal elements are taken
+ * from the first run first, so the merge is stable
+ */
+template<typename Iterator, typename Output>
+void parallel_merge(
+    Work_Stealing_Pool &pool,
+    Iterator            first,
+    Iterator            first_end,
+    Iterator            second,
+    Iterator            second_end,
+    Output              destination,
+    auto const         &comparator,
+    std::size_t         grain_size) {
+	auto const first_size  = first_end - first;
+	auto const second_size = second_end - second;
+	if (static_cast<std::size_t>(first_size + second_size) <= grain_size)
+	{
+		std::merge(
+		    std::make_move_iterator(first),
+		    std::make_move_iterator(first_end),
+		    std::make_move_iterator(second),
+		    std::make_move_iterator(second_end),
+		    destination,
+		    comparator);
+		return;
+	}
+
+	if (first_size >= second_size)
+	{
+		Iterator const first_split = first + first_size / 2;
+		Iterator const second_split =
+		    std::lower_bound(second, second_end, *first_split, comparator);
+		Output const split = destination + (first_split - first) + (second_split - second);
+		*split             = std::move(*first_split);
+		pool.invoke(
+		    [&] {
+			    parallel_merge(
+				pool,
+				first,
+				first_split,
+				second,
+				second_split,
+				destination,
+				comparator,
+				grain_size);
+		    },
+		    [&] {
+			    parallel_merge(
+				pool,
+				first_split + 1,
+				first_end,
+				second_split,
+				second_end,
+				split + 1,
+				comparator,
+				grain_size);
+		    });
+	}
+	else
+	{
+		Iterator const second_split = second + second_size / 2;
+		Iterator const first_split =
+		    std::upper_bound(first, first_end, *second_split, comparator);
+		Output const split = destination + (first_split - first) + (second_split - second);
+		*split             = std::move(*second_split);
+		pool.invoke(
+		    [&] {
+			    parallel_merge(
+				pool,
+				first,
+				first_split,
+				second,
+				second_split,
+				destination,
+				comparator,
+				grain_size);
+		    },
+		    [&] {
+			    parallel_merge(
+				pool,
+				first_split,
+				first_end,
+				second_split + 1,
+				second_end,
+				split + 1,
+				comparator,
+				grain_size);
+		    });
+	}
+}
+
+template<typename Iterator, typename Scratch>
+void parallel_merge_sort(
+    Work_Stealing_Pool &pool,
+    Iterator            begin,
+    Iterator            end,
+    Scratch             scratch,
+    auto const         &comparator,
+    std::size_t         grain_size) {
+	auto const size = end - begin;
+	if (size < 2 || static_cast<std::size_t>(size) <= grain_size)
+	{
+		merge_sort(begin, end, comparator);
+		return;
+	}
+
+	auto const     half   = size / 2;
+	Iterator const middle = begin + half;
+	pool.invoke(
+	    [&] { parallel_merge_sort(pool, begin, middle, scratch, comparator, grain_size); },
+	    [&] {
+		    parallel_merge_sort(pool, middle, end, scratch + half, comparator, grain_size);
+	    });
+
+	if (!comparator(*middle, *(middle - 1)))
+	{
+		return;
+	}
+
+	parallel_move(pool, begin, end, scratch, grain_size);
+	parallel_merge(
+	    pool,
+	    scratch,
+	    scratch + half,
+	    scratch + half,
+	    scratch + size,
+	    begin,
+	    comparator,
+	    grain_size);
+}
+
+template<typename Iterator>
+void parallel_quick_sort(
+    Work_Stealing_Pool &pool,
+    Iterator            begin,
+    Iterator            end,
+    int                 depth_limit,
+    auto const         &comparator,
+    std::size_t         grain_size) {
+	auto const size = end - begin;
+	if (size <= quick_sort_insertion_cutoff || static_cast<std::size_t>(size) <= grain_size
+	    || depth_limit == 0)
+	{
+		quick_sort(begin, end, comparator);
+		return;
+	}
+
+	move_pivot_to_begin(begin, end, comparator);
+	Iterator const cut = partition_around_begin(begin, end, comparator);
+	pool.invoke(
+	    [&] { parallel_quick_sort(pool, begin, cut, depth_limit - 1, comparator, grain_size); },
+	    [&] { parallel_quick_sort(pool, cut, end, depth_limit - 1, comparator, grain_size); });
+}
+
+} // namespace detail
+
+/**
+ *  @brief Uses merge sort on the given range such that each pair satisfies
+ *  comparator(first, second), splitting the work across the given pool. Both
+ *  halves of a range are sorted in parallel and then merged in parallel
+ *  through a single scratch array holding as many elements as the range,
+ *  which requires them to be default constructible. Ranges up to the grain
+ *  size are sorted with the sequential merge_sort. The sort is stable
+ */
+template<typename Iterator, typename Allocator = Default_Allocator<typename std::iterator_traits<Iterator>::value_type>>
+void parallel_merge_sort(
+    Work_Stealing_Pool &pool,
+    Iterator            begin,
+    Iterator            end,
+    auto const         &comparator,
+    std::size_t         grain_size = parallel_grain_size) {
+	using Value = typename std::iterator_traits<Iterator>::value_type;
+
+	auto const size = static_cast<std::size_t>(end - begin);
+	if (size <= grain_size)
+	{
+		merge_sort(begin, end, comparator);
+		return;
+	}
+
+	dsa::Dynamic_Array<Value, Allocator> scratch(size);
+	detail::parallel_merge_sort(pool, begin, end, scratch.begin(), comparator, grain_size);
+}
+
+/**
+ *  @brief Uses merge sort on the given range such that each pair satisfies
+ *  comparator(first, second), splitting the work across a pool of the given
+ *  number of threads
+ */
+template<typename Iterator>
+void parallel_merge_sort(
+    Iterator    begin,
+    Iterator    end,
+    auto const &comparator,
+    std::size_t thread_count = Work_Stealing_Pool::default_thread_count()) {
+	Work_Stealing_Pool pool(thread_count);
+	parallel_merge_sort(pool, begin, end, comparator);
+}
+
+/**
+ *  @brief Uses merge sort to sort the given range in ascending order,
+ *  splitting the work across a pool with a thread for every core
+ */
+template<typename Iterator>
+void parallel_merge_sort(Iterator begin, Iterator end) {
+	parallel_merge_sort(begin, end, std::less{});
+}
+
+/**
+ *  @brief Uses quick sort on the given range such that each pair satisfies
+ *  comparator(first, second), splitting the work across the given pool. Each
+ *  partition step runs on one thread and both partitions are then sorted in
+ *  parallel. Ranges up to the grain size, or past the recursion limit, are
+ *  sorted with the sequential quick_sort. The sort is unstable and does not
+ *  allocate besides the tasks given to the pool
+ */
+template<typename Iterator>
+void parallel_sort(
+    Work_Stealing_Pool &pool,
+    Iterator            begin,
+    Iterator            end,
+    auto const         &comparator,
+    std::size_t         grain_size = parallel_grain_size) {
+	auto const size  = static_cast<std::size_t>(end - begin);
+	auto const depth = static_cast<int>(std::bit_width(size));
+	detail::parallel_quick_sort(pool, begin, end, 2 * depth, comparator, grain_size);
+}
+
+/**
+ *  @brief Uses quick sort on the given range such that each pair satisfies
+ *  comparator(first, second), splitting the work across a pool of the given
+ *  number of threads
+ */
+template<typename Iterator>
+void parallel_sort(
+    Iterator    begin,
+    Iterator    end,
+    auto const &comparator,
+    std::size_t thread_count = Work_Stealing_Pool::default_thread_count()) {
+	Work_Stealing_Pool pool(thread_count);
+	parallel_sort(pool, begin, end, comparator);
+}
+
+/**
+ *  @brief Uses quick sort to sort the given range in ascending order,
+ *  splitting the work across a pool with a thread for every core
+ */
+template<typename Iterator>
+void parallel_sort(Iterator begin, Iterator end) {
+	parallel_sort(begin, end, std::less{});
+}
+
+} // namespace dsa
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef DSA_PARTITION_POINT_HPP
+#define DSA_PARTITION_POINT_HPP
+
+#include <iterator>
+#include <memory>
+
+namespace dsa
+{
+
+namespace detail
+{
+
+/**
+ * @brief Hints the CPU to start loading the cache line holding the element the
+ * iterator points to. Only contiguous iterators can be prefetched, the hint is
+ * dropped for any other iterator
+ */
+template<typename Iterator>
+void prefetch([[maybe_unused]] Iterator iterator) {
+#if defined(__GNUC__) || defined(__clang__)
+	if constexpr (std::contiguous_iterator<Iterator>)
+	{
+		__builtin_prefetch(std::to_address(iterator));
+	}
+#endif
+}
+
+} // namespace detail
+
+/**
+ *  @brief Finds the first element in a range partitioned by is_before, such
+ *  that is_before returns true for every element before it and false for the
+ *  rest. The range is halved with a conditional move rather than a branch, so
+ *  every search of the same length takes the same steps, and both possible
+ *  next midpoints are prefetched while the current one is compared
+ *  @return The first element for which is_before returns false, or end
+ */
+template<typename Iterator>
+Iterator partition_point(Iterator begin, Iterator end, auto const &is_before) {
+	using Difference = typename std::iterator_traits<Iterator>::difference_type;
+
+	Difference length = end - begin;
+	if (length == 0)
+	{
+		return begin;
+	}
+
+	while (length > 1)
+	{
+		Difference const half      = length / 2;
+		Difference const next_half = (length - half) / 2;
+		detail::prefetch(begin + next_half);
+		detail::prefetch(begin + half + next_half);
+
+		begin += static_cast<Difference>(is_before(*(begin + half))) * half;
+		length -= half;
+	}
+	return begin + static_cast<Difference>(is_before(*begin));
+}
+
+} // namespace dsa
+
+#endif
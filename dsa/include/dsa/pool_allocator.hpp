@@ -0,0 +1,133 @@
+#ifndef DSA_POOL_ALLOCATOR_HPP
+#define DSA_POOL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace dsa
+{
+
+/**
+ * @brief Hands out single element slots carved from large blocks, which is
+ * suited to node based containers such as the List and the Binary_Tree. Freed
+ * slots are kept in an intrusive free list and reused before new slots are
+ * carved. Requests for more than one element are forwarded to std::allocator.
+ *
+ * Each allocator owns its blocks, which are released when it is destroyed.
+ * Copying or rebinding an allocator therefore creates a new, empty pool and
+ * memory must be deallocated through the allocator which allocated it. The
+ * allocator is not thread safe, each container is expected to use its own.
+ *
+ * @tparam Value_t: The type of element to allocate
+ * @tparam Block_Size: The number of slots carved from each block
+ */
+template<typename Value_t, std::size_t Block_Size = 64>
+class Pool_Allocator
+{
+	static_assert(Block_Size > 0, "Blocks must hold at least one slot");
+
+ public:
+	template<typename T>
+	using rebind = Pool_Allocator<T, Block_Size>;
+
+	using Value = Value_t;
+
+	Pool_Allocator() = default;
+
+	template<typename T>
+	explicit Pool_Allocator(Pool_Allocator<T, Block_Size> const & /* allocator */) {
+	}
+
+	~Pool_Allocator() {
+		while (m_blocks != nullptr)
+		{
+			Block *next = m_blocks->m_next;
+			delete m_blocks;
+			m_blocks = next;
+		}
+	}
+
+	Pool_Allocator(Pool_Allocator const & /* allocator */) : Pool_Allocator() {
+	}
+
+	Pool_Allocator &operator=(Pool_Allocator const & /* allocator */) {
+		return *this;
+	}
+
+	Pool_Allocator(Pool_Allocator &&allocator) noexcept
+	    : m_blocks(std::exchange(allocator.m_blocks, nullptr))
+	    , m_free(std::exchange(allocator.m_free, nullptr))
+	    , m_carved(std::exchange(allocator.m_carved, Block_Size)) {
+	}
+
+	Pool_Allocator &operator=(Pool_Allocator &&allocator) noexcept {
+		Pool_Allocator moved(std::move(allocator));
+		swap(*this, moved);
+		return *this;
+	}
+
+	friend void swap(Pool_Allocator &lhs, Pool_Allocator &rhs) noexcept {
+		using std::swap;
+
+		swap(lhs.m_blocks, rhs.m_blocks);
+		swap(lhs.m_free, rhs.m_free);
+		swap(lhs.m_carved, rhs.m_carved);
+	}
+
+	[[nodiscard]] Value *allocate(std::size_t count) {
+		if (count != 1)
+		{
+			return std::allocator<Value>().allocate(count);
+		}
+
+		if (m_free != nullptr)
+		{
+			Slot *slot = m_free;
+			m_free     = slot->m_next;
+			return reinterpret_cast<Value *>(slot->m_storage);
+		}
+
+		if (m_carved == Block_Size)
+		{
+			Block *block  = new Block;
+			block->m_next = m_blocks;
+			m_blocks      = block;
+			m_carved      = 0;
+		}
+		return reinterpret_cast<Value *>(m_blocks->m_slots[m_carved++].m_storage);
+	}
+
+	void deallocate(Value *pointer, std::size_t count) {
+		if (count != 1)
+		{
+			std::allocator<Value>().deallocate(pointer, count);
+			return;
+		}
+
+		Slot *slot   = ::new (static_cast<void *>(pointer)) Slot;
+		slot->m_next = m_free;
+		m_free       = slot;
+	}
+
+ private:
+	union Slot
+	{
+		Slot *m_next;
+		alignas(Value) std::byte m_storage[sizeof(Value)];
+	};
+
+	struct Block
+	{
+		Block *m_next;
+		Slot   m_slots[Block_Size];
+	};
+
+	Block      *m_blocks = nullptr;
+	Slot       *m_free   = nullptr;
+	std::size_t m_carved = Block_Size;
+};
+
+} // namespace dsa
+
+#endif
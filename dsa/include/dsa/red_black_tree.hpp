@@ -0,0 +1,726 @@
+#ifndef DSA_RED_BLACK_TREE_HPP
+#define DSA_RED_BLACK_TREE_HPP
+
+#include <dsa/allocator_traits.hpp>
+#include <dsa/default_allocator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+namespace dsa
+{
+
+namespace detail
+{
+
+/**
+ * @brief Holds the parent of a red black tree node together with the colour of
+ * the node, stored next to each other for any kind of pointer
+ */
+template<typename Pointer>
+class Parent_And_Colour
+{
+ public:
+	[[nodiscard]] Pointer parent() const {
+		return m_parent;
+	}
+
+	void set_parent(Pointer parent) {
+		m_parent = parent;
+	}
+
+	[[nodiscard]] bool is_red() const {
+		return m_red;
+	}
+
+	void set_red(bool red) {
+		m_red = red;
+	}
+
+	friend auto operator<<(std::ostream &stream, Parent_And_Colour const &parent)
+	    -> std::ostream & {
+		return stream << parent.m_parent;
+	}
+
+ private:
+	Pointer m_parent = nullptr;
+	bool    m_red    = true;
+};
+
+/**
+ * @brief Raw pointers to nodes are aligned to at least two bytes, which leaves
+ * the lowest bit of the parent's address free to hold the colour, so the node
+ * does not grow by a padded flag
+ */
+template<typename Node>
+class Parent_And_Colour<Node *>
+{
+ public:
+	[[nodiscard]] Node *parent() const {
+		return reinterpret_cast<Node *>(m_bits & ~red_bit);
+	}
+
+	void set_parent(Node *parent) {
+		static_assert(alignof(Node) > 1, "The colour needs the lowest bit of the address");
+		m_bits = reinterpret_cast<std::uintptr_t>(parent) | (m_bits & red_bit);
+	}
+
+	[[nodiscard]] bool is_red() const {
+		return (m_bits & red_bit) != 0;
+	}
+
+	void set_red(bool red) {
+		m_bits = (m_bits & ~red_bit) | static_cast<std::uintptr_t>(red);
+	}
+
+	friend auto operator<<(std::ostream &stream, Parent_And_Colour const &parent)
+	    -> std::ostream & {
+		return stream << parent.parent();
+	}
+
+ private:
+	static constexpr std::uintptr_t red_bit = 1;
+
+	std::uintptr_t m_bits = red_bit;
+};
+
+template<typename Satellite_t, typename Allocator_t>
+class Red_Black_Tree_Node
+{
+ private:
+	using Alloc_Traits =
+	    Allocator_Traits<typename Allocator_t::template rebind<Red_Black_Tree_Node>>;
+	using Pointer       = typename Alloc_Traits::Pointer;
+	using Const_Pointer = typename Alloc_Traits::Const_Pointer;
+
+	using Satellite_Alloc_Traits =
+	    Allocator_Traits<typename Allocator_t::template rebind<Satellite_t>>;
+	using Satellite                 = typename Satellite_Alloc_Traits::Value;
+	using Satellite_Reference       = typename Satellite_Alloc_Traits::Reference;
+	using Satellite_Const_Reference = typename Satellite_Alloc_Traits::Const_Reference;
+
+	template<bool Is_Const>
+	class Iterator_Detail
+	{
+	 private:
+		using Node_Pointer = std::conditional_t<
+		    Is_Const,
+		    typename Red_Black_Tree_Node::Const_Pointer,
+		    typename Red_Black_Tree_Node::Pointer>;
+
+		using Reference = std::conditional_t<
+		    Is_Const,
+		    typename Red_Black_Tree_Node::Satellite_Const_Reference,
+		    typename Red_Black_Tree_Node::Satellite_Reference>;
+
+		using Satellite_Pointer =
+		    std::conditional_t<Is_Const, Satellite const *, Satellite *>;
+
+	 public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = Satellite;
+		using reference         = Reference;
+		using pointer           = Satellite_Pointer;
+
+		explicit Iterator_Detail(Node_Pointer node) : m_node(node) {
+		}
+
+		Iterator_Detail &operator++() {
+			m_node = next(m_node);
+			return *this;
+		}
+
+		Iterator_Detail operator++(int) {
+			Iterator_Detail iterator = *this;
+			++*this;
+			return iterator;
+		}
+
+		bool operator==(Iterator_Detail const &iterator) const {
+			return m_node == iterator.m_node;
+		}
+
+		bool operator!=(Iterator_Detail const &iterator) const {
+			return !this->operator==(iterator);
+		}
+
+		Reference operator*() const {
+			return m_node->m_satellite;
+		}
+
+		pointer operator->() const {
+			return std::addressof(m_node->m_satellite);
+		}
+
+	 private:
+		Node_Pointer m_node;
+
+		static Node_Pointer next(Node_Pointer node) {
+			if (node->m_right != nullptr)
+			{
+				node = node->m_right;
+				while (node->m_left != nullptr)
+				{
+					node = node->m_left;
+				}
+				return node;
+			}
+
+			Node_Pointer parent = node->parent();
+			while (parent != nullptr && parent->m_right == node)
+			{
+				node   = parent;
+				parent = node->parent();
+			}
+			return parent;
+		}
+	};
+
+ public:
+	using Iterator       = Iterator_Detail<false>;
+	using Const_Iterator = Iterator_Detail<true>;
+
+	Pointer                    m_left;
+	Pointer                    m_right;
+	Parent_And_Colour<Pointer> m_parent_and_colour;
+	Satellite                  m_satellite;
+
+	template<typename... Arguments>
+	explicit Red_Black_Tree_Node(Arguments &&...arguments)
+	    : m_left(nullptr)
+	    , m_right(nullptr)
+	    , m_satellite(std::forward<Arguments>(arguments)...) {
+	}
+
+	[[nodiscard]] Pointer parent() const {
+		return m_parent_and_colour.parent();
+	}
+
+	void set_parent(Pointer parent) {
+		m_parent_and_colour.set_parent(parent);
+	}
+
+	[[nodiscard]] bool is_red() const {
+		return m_parent_and_colour.is_red();
+	}
+
+	void set_red(bool red) {
+		m_parent_and_colour.set_red(red);
+	}
+
+	friend auto operator<<(std::ostream &stream, Red_Black_Tree_Node const &node)
+	    -> std::ostream & {
+		// Printing the parent through a copy would monitor the copy of a
+		// pointer which may not be constructed yet
+		return stream << '{' << node.m_left << ',' << node.m_parent_and_colour << ','
+			      << node.m_right << ',' << node.m_satellite << '}';
+	}
+};
+
+} // namespace detail
+
+/**
+ * @brief Holds a set of sortable elements in a red black tree, a binary search
+ * tree whose nodes are coloured red or black such that no red node has a red
+ * child and every path from a node down to a leaf passes through the same
+ * number of black nodes. Insertions and erasures restore those rules with at
+ * most three rotations, which keeps the height of the tree below twice the
+ * logarithm of its size, so every operation is O(log n) whatever the order of
+ * the inserted elements. Equal elements are kept in insertion order.
+ *
+ * @ingroup containers
+ *
+ * @tparam Value_t: The type of element to store
+ * @tparam Allocator_t: The type of allocator used for memory management
+ */
+template<typename Value_t, typename Allocator_t = Default_Allocator<Value_t>>
+class Red_Black_Tree
+{
+ private:
+	using Node               = detail::Red_Black_Tree_Node<Value_t, Allocator_t>;
+	using Node_Traits        = Allocator_Traits<typename Allocator_t::template rebind<Node>>;
+	using Node_Allocator     = typename Node_Traits::Allocator;
+	using Node_Pointer       = typename Node_Traits::Pointer;
+	using Node_Const_Pointer = typename Node_Traits::Const_Pointer;
+
+	using Alloc_Traits = Allocator_Traits<Allocator_t>;
+
+ public:
+	using Allocator       = typename Alloc_Traits::Allocator;
+	using Value           = typename Alloc_Traits::Value;
+	using Reference       = typename Alloc_Traits::Reference;
+	using Const_Reference = typename Alloc_Traits::Const_Reference;
+	using Pointer         = typename Alloc_Traits::Pointer;
+	using Iterator        = typename Node::Iterator;
+	using Const_Iterator  = typename Node::Const_Iterator;
+
+	/**
+	 * @brief Constructs an empty red black tree
+	 */
+	explicit Red_Black_Tree(Allocator const &allocator = Allocator{})
+	    : m_allocator(allocator) {
+	}
+
+	/**
+	 * @brief Constructs a red black tree filled with the given values
+	 */
+	Red_Black_Tree(std::initializer_list<Value_t> values,
+		       Allocator const                &allocator = Allocator())
+	    : m_allocator(allocator) {
+		for (auto value : values)
+		{
+			insert(value);
+		}
+	}
+
+	~Red_Black_Tree() {
+		clear();
+	}
+
+	Red_Black_Tree(Red_Black_Tree const &tree)
+	    : m_allocator(Node_Traits::propogate_or_create_instance(tree.m_allocator))
+	    , m_root(copy_subtree(nullptr, tree.m_root))
+	    , m_size(tree.m_size) {
+	}
+
+	Red_Black_Tree(Red_Black_Tree &&tree) noexcept
+	    : m_allocator(std::move(tree.m_allocator))
+	    , m_root(std::exchange(tree.m_root, nullptr))
+	    , m_size(std::exchange(tree.m_size, 0)) {
+	}
+
+	friend void swap(Red_Black_Tree &lhs, Red_Black_Tree &rhs) {
+		using std::swap;
+		swap(lhs.m_allocator, rhs.m_allocator);
+		swap(lhs.m_root, rhs.m_root);
+		swap(lhs.m_size, rhs.m_size);
+	}
+
+	Red_Black_Tree &operator=(Red_Black_Tree tree) noexcept {
+		swap(*this, tree);
+		return *this;
+	}
+
+	/**
+	 * @brief Returns true if the red black tree contains no elements
+	 */
+	[[nodiscard]] bool empty() const {
+		return m_root == nullptr;
+	}
+
+	[[nodiscard]] Iterator begin() {
+		return Iterator(first_node());
+	}
+
+	[[nodiscard]] Const_Iterator begin() const {
+		return Const_Iterator(first_node());
+	}
+
+	[[nodiscard]] Iterator end() {
+		return Iterator(nullptr);
+	}
+
+	[[nodiscard]] Const_Iterator end() const {
+		return Const_Iterator(nullptr);
+	}
+
+	/**
+	 * @brief Gets the number of elements currently in the red black tree
+	 */
+	[[nodiscard]] std::size_t size() const {
+		return m_size;
+	}
+
+	/**
+	 * @brief Gets the number of nodes on the longest path from the root to a
+	 * leaf, which is at most twice the logarithm of the size
+	 */
+	[[nodiscard]] std::size_t height() const {
+		return subtree_height(m_root);
+	}
+
+	/**
+	 * @brief Clears all elements from the red black tree
+	 */
+	void clear() {
+		delete_subtree(m_root);
+		m_root = nullptr;
+		m_size = 0;
+	}
+
+	/**
+	 * @brief Finds an element equal to the given one
+	 * @return An iterator to the element or end if there is none
+	 */
+	[[nodiscard]] Iterator find(Value_t const &value) {
+		return Iterator(find_node(value));
+	}
+
+	[[nodiscard]] Const_Iterator find(Value_t const &value) const {
+		return Const_Iterator(find_node(value));
+	}
+
+	/**
+	 * @brief Returns true if the red black tree contains the given element
+	 */
+	[[nodiscard]] bool contains(Value_t const &value) const {
+		return find_node(value) != nullptr;
+	}
+
+	/**
+	 * @brief Adds the given element into the red black tree
+	 */
+	void insert(Value_t value) {
+		emplace(std::move(value));
+	}
+
+	/**
+	 * @brief Constructs an element from the given arguments, directly
+	 * inside of its node, and adds it into the red black tree after any
+	 * equal elements
+	 * @return An iterator to the added element
+	 */
+	template<typename... Arguments>
+	Iterator emplace(Arguments &&...arguments) {
+		Node_Pointer insert = create_node(std::forward<Arguments>(arguments)...);
+
+		Node_Pointer parent  = nullptr;
+		bool         is_left = false;
+		for (Node_Pointer node = m_root; node != nullptr;)
+		{
+			parent  = node;
+			is_left = insert->m_satellite < node->m_satellite;
+			node    = is_left ? node->m_left : node->m_right;
+		}
+
+		insert->set_parent(parent);
+		if (parent == nullptr)
+		{
+			m_root = insert;
+		}
+		else
+		{
+			child(parent, !is_left) = insert;
+		}
+
+		++m_size;
+		repair_insertion(insert);
+		return Iterator(insert);
+	}
+
+	/**
+	 * @brief Removes an element equal to the given one from the red black
+	 * tree. The nodes of the other elements are relinked rather than having
+	 * their values moved, so iterators to them stay valid
+	 * @return false if there was no such element
+	 */
+	bool erase(Value_t const &value) {
+		Node_Pointer node = find_node(value);
+		if (node == nullptr)
+		{
+			return false;
+		}
+
+		erase_node(node);
+		return true;
+	}
+
+	friend bool operator==(Red_Black_Tree const &lhs, Red_Black_Tree const &rhs) noexcept {
+		return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	friend bool operator!=(Red_Black_Tree const &lhs, Red_Black_Tree const &rhs) noexcept {
+		return !(lhs == rhs);
+	}
+
+ private:
+	Node_Allocator m_allocator;
+
+	Node_Pointer m_root = nullptr;
+	std::size_t  m_size = 0;
+
+	/// @brief Returns the right child of the node if right is set, or its
+	/// left child otherwise, which lets the mirrored cases of the balancing
+	/// share their code
+	static Node_Pointer &child(Node_Pointer node, bool right) {
+		return right ? node->m_right : node->m_left;
+	}
+
+	static bool is_red(Node_Pointer node) {
+		return node != nullptr && node->is_red();
+	}
+
+	static Node_Pointer minimum(Node_Pointer node) {
+		while (node->m_left != nullptr)
+		{
+			node = node->m_left;
+		}
+		return node;
+	}
+
+	[[nodiscard]] Node_Pointer first_node() const {
+		return m_root == nullptr ? m_root : minimum(m_root);
+	}
+
+	static std::size_t subtree_height(Node_Pointer node) {
+		if (node == nullptr)
+		{
+			return 0;
+		}
+		return 1 + std::max(subtree_height(node->m_left), subtree_height(node->m_right));
+	}
+
+	[[nodiscard]] Node_Pointer find_node(Value_t const &value) const {
+		Node_Pointer node = m_root;
+		while (node != nullptr)
+		{
+			if (value < node->m_satellite)
+			{
+				node = node->m_left;
+			}
+			else if (node->m_satellite < value)
+			{
+				node = node->m_right;
+			}
+			else
+			{
+				return node;
+			}
+		}
+		return nullptr;
+	}
+
+	/**
+	 * @brief Puts the replacement, which may be null, in the place of the
+	 * node below the node's parent
+	 */
+	void replace(Node_Pointer node, Node_Pointer replacement) {
+		Node_Pointer parent = node->parent();
+		if (parent == nullptr)
+		{
+			m_root = replacement;
+		}
+		else
+		{
+			child(parent, parent->m_right == node) = replacement;
+		}
+
+		if (replacement != nullptr)
+		{
+			replacement->set_parent(parent);
+		}
+	}
+
+	/**
+	 * @brief Moves the node down to the given side, lifting its child on the
+	 * other side into its place. The in order sequence stays the same
+	 */
+	void rotate(Node_Pointer node, bool right) {
+		Node_Pointer pivot = child(node, !right);
+		Node_Pointer inner = child(pivot, right);
+
+		child(node, !right) = inner;
+		if (inner != nullptr)
+		{
+			inner->set_parent(node);
+		}
+
+		replace(node, pivot);
+		child(pivot, right) = node;
+		node->set_parent(pivot);
+	}
+
+	/**
+	 * @brief Restores the colouring rules after adding the given red node,
+	 * which may have a red parent
+	 */
+	void repair_insertion(Node_Pointer node) {
+		while (true)
+		{
+			Node_Pointer parent = node->parent();
+			if (parent == nullptr)
+			{
+				node->set_red(false);
+				return;
+			}
+
+			if (!parent->is_red())
+			{
+				return;
+			}
+
+			// The root is black, so a red parent has a parent of its own
+			Node_Pointer grandparent     = parent->parent();
+			bool const   parent_is_right = grandparent->m_right == parent;
+			Node_Pointer uncle           = child(grandparent, !parent_is_right);
+			if (is_red(uncle))
+			{
+				// Pushing the grandparent's black down to both of its
+				// children may leave the grandparent under a red node
+				parent->set_red(false);
+				uncle->set_red(false);
+				grandparent->set_red(true);
+				node = grandparent;
+				continue;
+			}
+
+			if (node == child(parent, !parent_is_right))
+			{
+				rotate(parent, parent_is_right);
+				parent = node;
+			}
+
+			rotate(grandparent, !parent_is_right);
+			parent->set_red(false);
+			grandparent->set_red(true);
+			return;
+		}
+	}
+
+	void erase_node(Node_Pointer node) {
+		// The node which takes the place of the removed black node, if any,
+		// is short of a black node on its paths
+		Node_Pointer lifted        = nullptr;
+		Node_Pointer lifted_parent = nullptr;
+		bool         removed_red   = node->is_red();
+
+		if (node->m_left == nullptr || node->m_right == nullptr)
+		{
+			lifted        = node->m_left != nullptr ? node->m_left : node->m_right;
+			lifted_parent = node->parent();
+			replace(node, lifted);
+		}
+		else
+		{
+			// The successor has no left child, it takes the node's place
+			// and colour and its right child takes the successor's place
+			Node_Pointer successor = minimum(node->m_right);
+			removed_red            = successor->is_red();
+			lifted                 = successor->m_right;
+			lifted_parent          = successor;
+			if (successor->parent() != node)
+			{
+				lifted_parent = successor->parent();
+				replace(successor, lifted);
+				successor->m_right = node->m_right;
+				successor->m_right->set_parent(successor);
+			}
+
+			replace(node, successor);
+			successor->m_left = node->m_left;
+			successor->m_left->set_parent(successor);
+			successor->set_red(node->is_red());
+		}
+
+		destroy_node(node);
+		--m_size;
+
+		if (!removed_red)
+		{
+			repair_erasure(lifted, lifted_parent);
+		}
+	}
+
+	/**
+	 * @brief Restores the colouring rules after removing a black node from
+	 * the paths through the given node, which may be null, below parent
+	 */
+	void repair_erasure(Node_Pointer node, Node_Pointer parent) {
+		while (node != m_root && !is_red(node))
+		{
+			// The paths through the sibling hold one more black node than
+			// the paths through node, so the sibling exists
+			bool const   node_is_right = parent->m_right == node;
+			Node_Pointer sibling       = child(parent, !node_is_right);
+			if (sibling->is_red())
+			{
+				sibling->set_red(false);
+				parent->set_red(true);
+				rotate(parent, node_is_right);
+				sibling = child(parent, !node_is_right);
+			}
+
+			if (!is_red(sibling->m_left) && !is_red(sibling->m_right))
+			{
+				// Removing a black node from the sibling's paths too moves
+				// the shortage up to the parent
+				sibling->set_red(true);
+				node   = parent;
+				parent = node->parent();
+				continue;
+			}
+
+			if (!is_red(child(sibling, !node_is_right)))
+			{
+				child(sibling, node_is_right)->set_red(false);
+				sibling->set_red(true);
+				rotate(sibling, !node_is_right);
+				sibling = child(parent, !node_is_right);
+			}
+
+			// Lifting the sibling over the parent adds a black node to the
+			// paths through node and keeps the others unchanged
+			sibling->set_red(parent->is_red());
+			parent->set_red(false);
+			child(sibling, !node_is_right)->set_red(false);
+			rotate(parent, node_is_right);
+			node = m_root;
+		}
+
+		if (node != nullptr)
+		{
+			node->set_red(false);
+		}
+	}
+
+	[[nodiscard]] Node_Pointer copy_subtree(Node_Pointer parent, Node_Pointer subtree) {
+		if (subtree == nullptr)
+		{
+			return nullptr;
+		}
+
+		Node_Pointer root = create_node(subtree->m_satellite);
+		root->set_parent(parent);
+		root->set_red(subtree->is_red());
+		root->m_left  = copy_subtree(root, subtree->m_left);
+		root->m_right = copy_subtree(root, subtree->m_right);
+		return root;
+	}
+
+	template<typename... Arguments>
+	Node_Pointer create_node(Arguments &&...arguments) {
+		Node_Pointer pointer = Node_Traits::allocate(m_allocator, 1);
+		Node_Traits::construct(m_allocator, pointer, std::forward<Arguments>(arguments)...);
+		return pointer;
+	}
+
+	void destroy_node(Node_Pointer node) {
+		Node_Traits::destroy(m_allocator, node);
+		Node_Traits::deallocate(m_allocator, node, 1);
+	}
+
+	/// @brief The height of the tree is logarithmic, so the recursion depth
+	/// is too
+	void delete_subtree(Node_Pointer node) {
+		if (node == nullptr)
+		{
+			return;
+		}
+
+		delete_subtree(node->m_left);
+		delete_subtree(node->m_right);
+		destroy_node(node);
+	}
+};
+
+} // namespace dsa
+
+#endif
@@ -0,0 +1,487 @@
+#ifndef DSA_RING_DEQUE_HPP
+#define DSA_RING_DEQUE_HPP
+
+#include <dsa/allocator_traits.hpp>
+#include <dsa/default_allocator.hpp>
+#include <dsa/memory.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace dsa
+{
+
+/**
+ * @brief Holds a sequence of elements in a contiguous ring whose capacity is
+ * always a power of two, so that positions wrap around it with a mask instead
+ * of a division. Elements can be added and removed at both ends in constant
+ * time, the ring doubling in size when it is full.
+ *
+ * The front and back positions count up freely and are only masked when
+ * indexing the storage, which makes them usable as the acquire / release
+ * indices of a single producer, single consumer queue: try_push appends at
+ * the back and try_pop removes from the front without taking a lock, so long
+ * as one thread only pushes and another only pops. These never grow the ring,
+ * the capacity should be reserved beforehand, and no other member may be
+ * used while the deque is shared between threads.
+ *
+ * @ingroup containers
+ *
+ * @tparam Value_t: The type of element to store
+ * @tparam Allocator_t: The type of allocator used for memory management
+ */
+template<typename Value_t, typename Allocator_t = Default_Allocator<Value_t>>
+class Ring_Deque
+{
+ private:
+	using Alloc_Traits = Allocator_Traits<Allocator_t>;
+
+ public:
+	using Allocator       = typename Alloc_Traits::Allocator;
+	using Value           = typename Alloc_Traits::Value;
+	using Reference       = typename Alloc_Traits::Reference;
+	using Const_Reference = typename Alloc_Traits::Const_Reference;
+	using Pointer         = typename Alloc_Traits::Pointer;
+	using Const_Pointer   = typename Alloc_Traits::Const_Pointer;
+
+ private:
+	template<bool Is_Const>
+	class Iterator_Detail
+	{
+	 private:
+		using Deque_Pointer = std::conditional_t<Is_Const, Ring_Deque const *, Ring_Deque *>;
+		using Reference = std::conditional_t<
+		    Is_Const,
+		    typename Ring_Deque::Const_Reference,
+		    typename Ring_Deque::Reference>;
+
+	 public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = typename Ring_Deque::Value;
+		using reference         = Reference;
+
+		Iterator_Detail(Deque_Pointer deque, std::size_t index) : m_deque(deque), m_index(index) {
+		}
+
+		Iterator_Detail &operator++() {
+			++m_index;
+			return *this;
+		}
+
+		bool operator==(Iterator_Detail const &iterator) const = default;
+
+		Reference operator*() const {
+			return (*m_deque)[m_index];
+		}
+
+	 private:
+		Deque_Pointer m_deque;
+		std::size_t   m_index;
+	};
+
+ public:
+	using Iterator       = Iterator_Detail<false>;
+	using Const_Iterator = Iterator_Detail<true>;
+
+	[[nodiscard]] Allocator const &allocator() const {
+		return m_allocator;
+	}
+
+	/**
+	 * @brief Constructs an empty deque
+	 */
+	explicit Ring_Deque(Allocator allocator = Allocator()) : m_allocator(std::move(allocator)) {
+	}
+
+	/**
+	 * @brief Constructs a deque filled with the given values
+	 */
+	Ring_Deque(std::initializer_list<Value_t> values, Allocator allocator = Allocator())
+	    : m_allocator(std::move(allocator))
+	    , m_capacity(std::bit_ceil(values.size()))
+	    , m_storage(Alloc_Traits::allocate(m_allocator, m_capacity)) {
+		std::uninitialized_copy(std::begin(values), std::end(values), m_storage);
+		m_tail.store(values.size(), std::memory_order_relaxed);
+	}
+
+	~Ring_Deque() {
+		if (m_storage == nullptr)
+		{
+			return;
+		}
+
+		clear();
+		Alloc_Traits::deallocate(m_allocator, m_storage, m_capacity);
+	}
+
+	Ring_Deque(Ring_Deque const &deque)
+	    : m_allocator(Alloc_Traits::propogate_or_create_instance(deque.allocator()))
+	    , m_capacity(deque.capacity())
+	    , m_storage(Alloc_Traits::allocate(m_allocator, m_capacity)) {
+		std::uninitialized_copy(deque.begin(), deque.end(), m_storage);
+		m_tail.store(deque.size(), std::memory_order_relaxed);
+	}
+
+	Ring_Deque &operator=(Ring_Deque const &deque) {
+		using std::swap;
+
+		Ring_Deque copy(deque);
+		swap(*this, copy);
+		return *this;
+	}
+
+	Ring_Deque(Ring_Deque &&deque) noexcept
+	    : m_allocator(std::move(deque.m_allocator))
+	    , m_capacity(deque.m_capacity)
+	    , m_storage(deque.m_storage)
+	    , m_head(deque.m_head.load(std::memory_order_relaxed))
+	    , m_tail(deque.m_tail.load(std::memory_order_relaxed)) {
+		deque.m_capacity = 0;
+		deque.m_storage  = nullptr;
+		deque.m_head.store(0, std::memory_order_relaxed);
+		deque.m_tail.store(0, std::memory_order_relaxed);
+	}
+
+	Ring_Deque &operator=(Ring_Deque &&deque) noexcept {
+		using std::swap;
+
+		swap(*this, deque);
+		return *this;
+	}
+
+	friend void swap(Ring_Deque &lhs, Ring_Deque &rhs) noexcept {
+		using std::swap;
+
+		swap(lhs.m_allocator, rhs.m_allocator);
+		swap(lhs.m_capacity, rhs.m_capacity);
+		swap(lhs.m_storage, rhs.m_storage);
+		std::size_t const head = lhs.head();
+		std::size_t const tail = lhs.tail();
+		lhs.m_head.store(rhs.head(), std::memory_order_relaxed);
+		lhs.m_tail.store(rhs.tail(), std::memory_order_relaxed);
+		rhs.m_head.store(head, std::memory_order_relaxed);
+		rhs.m_tail.store(tail, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Checks if each element in both deques is equal
+	 */
+	[[nodiscard]] friend bool operator==(Ring_Deque const &lhs, Ring_Deque const &rhs) noexcept {
+		return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	/**
+	 * @brief Checks if any element in both deques differs
+	 */
+	[[nodiscard]] friend bool operator!=(Ring_Deque const &lhs, Ring_Deque const &rhs) noexcept {
+		return !(lhs == rhs);
+	}
+
+	/**
+	 * @brief Gets the first element in the deque. This is undefined
+	 * behaviour if the deque is empty
+	 */
+	[[nodiscard]] Reference front() {
+		return (*this)[0];
+	}
+
+	/**
+	 * @brief Gets the first element in the deque. This is undefined
+	 * behaviour if the deque is empty
+	 */
+	[[nodiscard]] Const_Reference front() const {
+		return (*this)[0];
+	}
+
+	/**
+	 * @brief Gets the last element in the deque. This is undefined
+	 * behaviour if the deque is empty
+	 */
+	[[nodiscard]] Reference back() {
+		return (*this)[size() - 1];
+	}
+
+	/**
+	 * @brief Gets the last element in the deque. This is undefined
+	 * behaviour if the deque is empty
+	 */
+	[[nodiscard]] Const_Reference back() const {
+		return (*this)[size() - 1];
+	}
+
+	[[nodiscard]] Reference operator[](std::size_t index) {
+		return m_storage[wrap(head() + index)];
+	}
+
+	[[nodiscard]] Const_Reference operator[](std::size_t index) const {
+		return m_storage[wrap(head() + index)];
+	}
+
+	[[nodiscard]] Iterator begin() {
+		return Iterator(this, 0);
+	}
+
+	[[nodiscard]] Const_Iterator begin() const {
+		return Const_Iterator(this, 0);
+	}
+
+	[[nodiscard]] Iterator end() {
+		return Iterator(this, size());
+	}
+
+	[[nodiscard]] Const_Iterator end() const {
+		return Const_Iterator(this, size());
+	}
+
+	/**
+	 * @brief Returns true if the deque holds no elements
+	 */
+	[[nodiscard]] bool empty() const {
+		return size() == 0;
+	}
+
+	/**
+	 * @brief Returns the number of elements that the deque holds
+	 */
+	[[nodiscard]] std::size_t size() const {
+		return tail() - head();
+	}
+
+	/**
+	 * @brief Returns the number of elements that the deque can hold without
+	 * growing, which is always zero or a power of two
+	 */
+	[[nodiscard]] std::size_t capacity() const {
+		return m_capacity;
+	}
+
+	/**
+	 * @brief Inserts the given value at the front of the deque
+	 */
+	void prepend(Value value) {
+		emplace_front(std::move(value));
+	}
+
+	/**
+	 * @brief Inserts the given value at the back of the deque
+	 */
+	void append(Value value) {
+		emplace_back(std::move(value));
+	}
+
+	/**
+	 * @brief Constructs a value at the front of the deque from the given
+	 * arguments
+	 */
+	template<typename... Arguments>
+	Reference emplace_front(Arguments &&...arguments) {
+		if (size() == capacity())
+		{
+			// Growing moves the elements, so the value is built first in
+			// case the arguments refer to one of them
+			Value value(std::forward<Arguments>(arguments)...);
+			grow();
+			return construct_front(std::move(value));
+		}
+		return construct_front(std::forward<Arguments>(arguments)...);
+	}
+
+	/**
+	 * @brief Constructs a value at the back of the deque from the given
+	 * arguments
+	 */
+	template<typename... Arguments>
+	Reference emplace_back(Arguments &&...arguments) {
+		if (size() == capacity())
+		{
+			// Growing moves the elements, so the value is built first in
+			// case the arguments refer to one of them
+			Value value(std::forward<Arguments>(arguments)...);
+			grow();
+			return construct_back(std::move(value));
+		}
+		return construct_back(std::forward<Arguments>(arguments)...);
+	}
+
+	/**
+	 * @brief Erases the first element. The behaviour is undefined if the
+	 * deque is empty
+	 */
+	void pop_front() {
+		std::size_t const position = head();
+		Alloc_Traits::destroy(m_allocator, m_storage + wrap(position));
+		m_head.store(position + 1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Erases the last element. The behaviour is undefined if the
+	 * deque is empty
+	 */
+	void pop_back() {
+		std::size_t const position = tail() - 1;
+		Alloc_Traits::destroy(m_allocator, m_storage + wrap(position));
+		m_tail.store(position, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Erases all elements, keeping the storage
+	 */
+	void clear() {
+		while (!empty())
+		{
+			pop_back();
+		}
+		m_head.store(0, std::memory_order_relaxed);
+		m_tail.store(0, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Reallocates the ring to hold at least the given number of
+	 * elements without growing, rounded up to a power of two
+	 */
+	void reserve(std::size_t new_capacity) {
+		if (capacity() >= new_capacity)
+		{
+			return;
+		}
+
+		reallocate(std::bit_ceil(new_capacity));
+	}
+
+	/**
+	 * @brief Moves the value to the back of the deque. Only one thread may
+	 * push at a time, while another pops with try_pop
+	 * @return false, leaving the value untouched, if the deque was full
+	 */
+	bool try_push(Value_t &&value) {
+		return push(value);
+	}
+
+	/**
+	 * @brief Copies the value to the back of the deque. Only one thread may
+	 * push at a time, while another pops with try_pop
+	 * @return false if the deque was full
+	 */
+	bool try_push(Value_t const &value) {
+		Value_t copy(value);
+		return push(copy);
+	}
+
+	/**
+	 * @brief Removes the element at the front of the deque. Only one thread
+	 * may pop at a time, while another pushes with try_push
+	 * @return The element, or nothing if the deque was empty
+	 */
+	std::optional<Value_t> try_pop() {
+		std::size_t const position = m_head.load(std::memory_order_relaxed);
+		if (position == m_tail.load(std::memory_order_acquire))
+		{
+			return std::nullopt;
+		}
+
+		Pointer                slot = m_storage + wrap(position);
+		std::optional<Value_t> value(std::move(*slot));
+		Alloc_Traits::destroy(m_allocator, slot);
+		m_head.store(position + 1, std::memory_order_release);
+		return value;
+	}
+
+ private:
+	Allocator   m_allocator;
+	std::size_t m_capacity = 0;
+	Pointer     m_storage  = nullptr;
+
+	// The consumer only writes the head and the producer only the tail, so
+	// they are kept on separate cache lines
+	alignas(detail::cache_line_size) std::atomic<std::size_t> m_head = 0;
+	alignas(detail::cache_line_size) std::atomic<std::size_t> m_tail = 0;
+
+	[[nodiscard]] std::size_t head() const {
+		return m_head.load(std::memory_order_relaxed);
+	}
+
+	[[nodiscard]] std::size_t tail() const {
+		return m_tail.load(std::memory_order_relaxed);
+	}
+
+	/// @brief Maps a freely counting position onto the storage
+	[[nodiscard]] std::size_t wrap(std::size_t position) const {
+		return position & (m_capacity - 1);
+	}
+
+	template<typename... Arguments>
+	Reference construct_front(Arguments &&...arguments) {
+		std::size_t const position = head() - 1;
+		Alloc_Traits::construct(
+		    m_allocator,
+		    m_storage + wrap(position),
+		    std::forward<Arguments>(arguments)...);
+		m_head.store(position, std::memory_order_relaxed);
+		return m_storage[wrap(position)];
+	}
+
+	template<typename... Arguments>
+	Reference construct_back(Arguments &&...arguments) {
+		std::size_t const position = tail();
+		Alloc_Traits::construct(
+		    m_allocator,
+		    m_storage + wrap(position),
+		    std::forward<Arguments>(arguments)...);
+		m_tail.store(position + 1, std::memory_order_relaxed);
+		return m_storage[wrap(position)];
+	}
+
+	/// @brief Claims the back slot for the producer and moves the value into it
+	bool push(Value_t &value) {
+		std::size_t const position = m_tail.load(std::memory_order_relaxed);
+		if (position - m_head.load(std::memory_order_acquire) == m_capacity)
+		{
+			return false;
+		}
+
+		Alloc_Traits::construct(m_allocator, m_storage + wrap(position), std::move(value));
+		m_tail.store(position + 1, std::memory_order_release);
+		return true;
+	}
+
+	void grow() {
+		reallocate(std::max<std::size_t>(2 * capacity(), 1));
+	}
+
+	/**
+	 * @brief Moves the held elements to the start of a new allocation of the
+	 * given capacity, which must be a power of two large enough to hold them
+	 */
+	void reallocate(std::size_t new_capacity) {
+		std::size_t const count   = size();
+		Pointer           storage = Alloc_Traits::allocate(m_allocator, new_capacity);
+		if (m_storage != nullptr)
+		{
+			// The elements may wrap around the end of the ring, in which
+			// case they are relocated in two parts
+			Pointer const     first  = m_storage + wrap(head());
+			std::size_t const before = std::min(count, capacity() - wrap(head()));
+			uninitialized_relocate(first, first + before, storage);
+			uninitialized_relocate(m_storage, m_storage + (count - before), storage + before);
+			Alloc_Traits::deallocate(m_allocator, m_storage, m_capacity);
+		}
+
+		m_storage  = storage;
+		m_capacity = new_capacity;
+		m_head.store(0, std::memory_order_relaxed);
+		m_tail.store(count, std::memory_order_relaxed);
+	}
+};
+
+} // namespace dsa
+
+#endif
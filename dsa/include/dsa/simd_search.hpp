@@ -0,0 +1,297 @@
+#ifndef DSA_SIMD_SEARCH_HPP
+#define DSA_SIMD_SEARCH_HPP
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+	#define DSA_SIMD_SEARCH_X86
+	#include <immintrin.h>
+#endif
+
+namespace dsa::detail
+{
+
+/**
+ * @brief Element types whose equality can be checked a whole vector register at
+ * a time: integers compare their bytes and floating point values use the IEEE
+ * comparison, which treats -0.0 as equal to 0.0 and NaN as equal to nothing
+ */
+template<typename Value>
+concept Simd_Searchable =
+    (std::integral<Value> && !std::same_as<Value, bool> && sizeof(Value) <= 8)
+    || std::same_as<Value, float> || std::same_as<Value, double>;
+
+enum class Simd_Level
+{
+	none,
+	sse2,
+	avx2,
+	avx512
+};
+
+template<typename Value>
+Value const *find_equal_scalar(Value const *begin, Value const *end, Value value) {
+	for (; begin != end; ++begin)
+	{
+		if (*begin == value)
+		{
+			return begin;
+		}
+	}
+	return end;
+}
+
+#ifdef DSA_SIMD_SEARCH_X86
+
+/**
+ * @brief Returns the instruction sets which can be used on the current CPU,
+ * checked once on first use
+ */
+inline Simd_Level simd_level() {
+	static Simd_Level const level = [] {
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+		{
+			return Simd_Level::avx512;
+		}
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return Simd_Level::avx2;
+		}
+		return Simd_Level::sse2;
+	}();
+	return level;
+}
+
+/// @brief Returns the index of the first lane with its bits set in a mask
+/// holding the given number of bits for every lane
+inline std::size_t first_set_lane(std::uint64_t mask, std::size_t bits_per_lane) {
+	return static_cast<std::size_t>(std::countr_zero(mask)) / bits_per_lane;
+}
+
+/// @brief Returns the lanes of a register of the given size which all hold
+/// value, ready to be loaded by a function compiled for that register
+template<std::size_t Register_Bytes, typename Value>
+std::array<Value, Register_Bytes / sizeof(Value)> repeated(Value value) {
+	std::array<Value, Register_Bytes / sizeof(Value)> lanes;
+	lanes.fill(value);
+	return lanes;
+}
+
+/// @brief Sets every byte of the lanes equal to the needle, SSE2 has no 64 bit
+/// integer comparison so those compare both halves and combine them
+template<typename Value>
+__m128i equal_lanes_sse2(__m128i chunk, __m128i needle) {
+	if constexpr (std::same_as<Value, float>)
+	{
+		__m128 const equal =
+		    _mm_cmpeq_ps(_mm_castsi128_ps(chunk), _mm_castsi128_ps(needle));
+		return _mm_castps_si128(equal);
+	}
+	else if constexpr (std::same_as<Value, double>)
+	{
+		__m128d const equal =
+		    _mm_cmpeq_pd(_mm_castsi128_pd(chunk), _mm_castsi128_pd(needle));
+		return _mm_castpd_si128(equal);
+	}
+	else if constexpr (sizeof(Value) == 1)
+	{
+		return _mm_cmpeq_epi8(chunk, needle);
+	}
+	else if constexpr (sizeof(Value) == 2)
+	{
+		return _mm_cmpeq_epi16(chunk, needle);
+	}
+	else if constexpr (sizeof(Value) == 4)
+	{
+		return _mm_cmpeq_epi32(chunk, needle);
+	}
+	else
+	{
+		__m128i const halves = _mm_cmpeq_epi32(chunk, needle);
+		return _mm_and_si128(halves, _mm_shuffle_epi32(halves, 0b10'11'00'01));
+	}
+}
+
+template<typename Value>
+__m128i load_sse2(Value const *pointer) {
+	return _mm_loadu_si128(reinterpret_cast<__m128i const *>(pointer));
+}
+
+template<typename Value>
+Value const *find_equal_sse2(Value const *begin, Value const *end, Value value) {
+	constexpr std::ptrdiff_t lanes   = sizeof(__m128i) / sizeof(Value);
+	auto const               needles = repeated<sizeof(__m128i)>(value);
+	__m128i const            needle  = load_sse2(needles.data());
+	for (; end - begin >= lanes; begin += lanes)
+	{
+		__m128i const equal = equal_lanes_sse2<Value>(load_sse2(begin), needle);
+		auto const    mask  = static_cast<std::uint32_t>(_mm_movemask_epi8(equal));
+		if (mask != 0)
+		{
+			return begin + first_set_lane(mask, sizeof(Value));
+		}
+	}
+	return find_equal_scalar(begin, end, value);
+}
+
+template<typename Value>
+__attribute__((target("avx2"))) __m256i equal_lanes_avx2(__m256i chunk, __m256i needle) {
+	if constexpr (std::same_as<Value, float>)
+	{
+		__m256 const equal = _mm256_cmp_ps(
+		    _mm256_castsi256_ps(chunk),
+		    _mm256_castsi256_ps(needle),
+		    _CMP_EQ_OQ);
+		return _mm256_castps_si256(equal);
+	}
+	else if constexpr (std::same_as<Value, double>)
+	{
+		__m256d const equal = _mm256_cmp_pd(
+		    _mm256_castsi256_pd(chunk),
+		    _mm256_castsi256_pd(needle),
+		    _CMP_EQ_OQ);
+		return _mm256_castpd_si256(equal);
+	}
+	else if constexpr (sizeof(Value) == 1)
+	{
+		return _mm256_cmpeq_epi8(chunk, needle);
+	}
+	else if constexpr (sizeof(Value) == 2)
+	{
+		return _mm256_cmpeq_epi16(chunk, needle);
+	}
+	else if constexpr (sizeof(Value) == 4)
+	{
+		return _mm256_cmpeq_epi32(chunk, needle);
+	}
+	else
+	{
+		return _mm256_cmpeq_epi64(chunk, needle);
+	}
+}
+
+template<typename Value>
+__attribute__((target("avx2"))) __m256i load_avx2(Value const *pointer) {
+	return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(pointer));
+}
+
+template<typename Value>
+__attribute__((target("avx2"))) Value const *
+find_equal_avx2(Value const *begin, Value const *end, Value value) {
+	constexpr std::ptrdiff_t lanes   = sizeof(__m256i) / sizeof(Value);
+	auto const               needles = repeated<sizeof(__m256i)>(value);
+	__m256i const            needle  = load_avx2(needles.data());
+	for (; end - begin >= lanes; begin += lanes)
+	{
+		__m256i const equal = equal_lanes_avx2<Value>(load_avx2(begin), needle);
+		auto const    mask  = static_cast<std::uint32_t>(_mm256_movemask_epi8(equal));
+		if (mask != 0)
+		{
+			return begin + first_set_lane(mask, sizeof(Value));
+		}
+	}
+	return find_equal_sse2(begin, end, value);
+}
+
+/// @brief Returns a mask with one bit for every lane equal to the needle
+template<typename Value>
+__attribute__((target("avx512f,avx512bw"))) std::uint64_t
+equal_lanes_avx512(__m512i chunk, __m512i needle) {
+	if constexpr (std::same_as<Value, float>)
+	{
+		return _mm512_cmp_ps_mask(
+		    _mm512_castsi512_ps(chunk),
+		    _mm512_castsi512_ps(needle),
+		    _CMP_EQ_OQ);
+	}
+	else if constexpr (std::same_as<Value, double>)
+	{
+		return _mm512_cmp_pd_mask(
+		    _mm512_castsi512_pd(chunk),
+		    _mm512_castsi512_pd(needle),
+		    _CMP_EQ_OQ);
+	}
+	else if constexpr (sizeof(Value) == 1)
+	{
+		return _mm512_cmpeq_epi8_mask(chunk, needle);
+	}
+	else if constexpr (sizeof(Value) == 2)
+	{
+		return _mm512_cmpeq_epi16_mask(chunk, needle);
+	}
+	else if constexpr (sizeof(Value) == 4)
+	{
+		return _mm512_cmpeq_epi32_mask(chunk, needle);
+	}
+	else
+	{
+		return _mm512_cmpeq_epi64_mask(chunk, needle);
+	}
+}
+
+template<typename Value>
+__attribute__((target("avx512f,avx512bw"))) Value const *
+find_equal_avx512(Value const *begin, Value const *end, Value value) {
+	constexpr std::ptrdiff_t lanes   = sizeof(__m512i) / sizeof(Value);
+	auto const               needles = repeated<sizeof(__m512i)>(value);
+	__m512i const            needle  = _mm512_loadu_si512(needles.data());
+	for (; end - begin >= lanes; begin += lanes)
+	{
+		__m512i const       chunk = _mm512_loadu_si512(begin);
+		std::uint64_t const mask  = equal_lanes_avx512<Value>(chunk, needle);
+		if (mask != 0)
+		{
+			return begin + first_set_lane(mask, 1);
+		}
+	}
+	return find_equal_avx2(begin, end, value);
+}
+
+#else
+
+inline Simd_Level simd_level() {
+	return Simd_Level::none;
+}
+
+#endif
+
+/**
+ * @brief Returns the first element in [begin, end) equal to value, or end,
+ * comparing as many elements at once as the given instruction set allows. The
+ * level must be supported by the CPU, see simd_level
+ */
+template<Simd_Searchable Value>
+Value const *find_equal(
+    Value const               *begin,
+    Value const               *end,
+    Value                      value,
+    [[maybe_unused]] Simd_Level level) {
+#ifdef DSA_SIMD_SEARCH_X86
+	switch (level)
+	{
+	case Simd_Level::avx512:
+		return find_equal_avx512(begin, end, value);
+	case Simd_Level::avx2:
+		return find_equal_avx2(begin, end, value);
+	case Simd_Level::sse2:
+		return find_equal_sse2(begin, end, value);
+	case Simd_Level::none:
+		break;
+	}
+#endif
+	return find_equal_scalar(begin, end, value);
+}
+
+template<Simd_Searchable Value>
+Value const *find_equal(Value const *begin, Value const *end, Value value) {
+	return find_equal(begin, end, value, simd_level());
+}
+
+} // namespace dsa::detail
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef DSA_TYPE_TRAITS_HPP
 #define DSA_TYPE_TRAITS_HPP
 
+#include <iterator>
 #include <type_traits>
 
 namespace dsa
@@ -25,6 +26,29 @@ struct Is_Same<Type, T>
 template<typename Type, typename... Arguments>
 constexpr bool Is_Same_v = Is_Same<Type, Arguments...>::value;
 
+/**
+ * @brief Marks types whose objects can be moved to a new address by copying
+ * their bytes and forgetting the original, without running any constructor or
+ * destructor. Types which are not trivially copyable but still have this
+ * property, such as those owning a heap allocation through a raw pointer, may
+ * specialise this trait to opt in.
+ */
+template<typename T>
+struct Is_Trivially_Relocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
+{};
+
+template<typename T>
+constexpr bool Is_Trivially_Relocatable_v = Is_Trivially_Relocatable<T>::value;
+
+/**
+ * @brief An input iterator whose distance to the end of a range can be known
+ * before traversing it
+ */
+template<typename Iterator>
+concept Sized_Input_Iterator =
+    std::input_iterator<Iterator>
+    && (std::forward_iterator<Iterator> || std::sized_sentinel_for<Iterator, Iterator>);
+
 template<typename... Arguments>
 struct Overloaded_Lambda : Arguments...
 {
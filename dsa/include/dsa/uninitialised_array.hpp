@@ -0,0 +1,76 @@
+#ifndef DSA_UNINITIALISED_ARRAY_HPP
+#define DSA_UNINITIALISED_ARRAY_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace dsa
+{
+
+namespace detail
+{
+
+/**
+ * @brief Storage for up to Capacity contiguous values, which are constructed
+ * and destroyed by the owner of the storage so that a node only builds the
+ * values it holds
+ */
+template<typename Value, std::size_t Capacity>
+class Uninitialised_Array
+{
+ public:
+	// User provided, so that value initialising a node does not zero the
+	// storage
+	Uninitialised_Array() {
+	}
+
+	[[nodiscard]] Value *data() {
+		return std::launder(reinterpret_cast<Value *>(m_bytes.data()));
+	}
+
+	[[nodiscard]] Value const *data() const {
+		return std::launder(reinterpret_cast<Value const *>(m_bytes.data()));
+	}
+
+	Value &operator[](std::size_t index) {
+		return data()[index];
+	}
+
+	Value const &operator[](std::size_t index) const {
+		return data()[index];
+	}
+
+ private:
+	alignas(Value) std::array<std::byte, Capacity * sizeof(Value)> m_bytes;
+};
+
+/// @brief Makes room for a value at index among the first count values, which
+/// leaves the storage at index uninitialised
+template<typename Value>
+void open_gap(Value *values, std::size_t count, std::size_t index) {
+	if (index == count)
+	{
+		return;
+	}
+
+	std::construct_at(values + count, std::move(values[count - 1]));
+	std::move_backward(values + index, values + count - 1, values + count);
+	std::destroy_at(values + index);
+}
+
+/// @brief Removes the value at index from the first count values by moving
+/// the values after it down, which leaves the last storage uninitialised
+template<typename Value>
+void close_gap(Value *values, std::size_t count, std::size_t index) {
+	std::move(values + index + 1, values + count, values + index);
+	std::destroy_at(values + count - 1);
+}
+
+} // namespace detail
+
+} // namespace dsa
+
+#endif
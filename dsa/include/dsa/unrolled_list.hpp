@@ -0,0 +1,508 @@
+#ifndef DSA_UNROLLED_LIST_HPP
+#define DSA_UNROLLED_LIST_HPP
+
+#include <dsa/allocator_traits.hpp>
+#include <dsa/default_allocator.hpp>
+#include <dsa/memory.hpp>
+#include <dsa/uninitialised_array.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace dsa
+{
+
+/**
+ * @brief Holds a sequence of elements in a singly linked list whose nodes
+ * each pack up to Node_Capacity elements contiguously. Traversing the list
+ * follows one link and takes one allocation for every node rather than for
+ * every element, so small elements are read a cache line at a time.
+ *
+ * Inserting into a full node splits it into two half full nodes, and erasing
+ * from a node less than half full merges the next node into it when both fit
+ * in one node. Inserting or erasing moves the later elements of the node,
+ * which invalidates iterators to the node.
+ *
+ * The allocator is rebound to the nodes and must hand out raw pointers.
+ *
+ * @ingroup containers
+ *
+ * @tparam Value_t: The type of element to store
+ * @tparam Node_Capacity: The number of elements which fit in a node
+ * @tparam Allocator_t: The type of allocator used for memory management
+ */
+template<
+    typename Value_t,
+    std::size_t Node_Capacity = 16,
+    typename Allocator_t      = Default_Allocator<Value_t>>
+class Unrolled_List
+{
+ private:
+	static_assert(Node_Capacity >= 2, "A full node must split into two nodes");
+
+	struct Node
+	{
+		Node() {
+		}
+
+		std::size_t                                         m_count = 0;
+		Node                                               *m_next  = nullptr;
+		detail::Uninitialised_Array<Value_t, Node_Capacity> m_values;
+	};
+
+	using Node_Traits    = Allocator_Traits<typename Allocator_t::template rebind<Node>>;
+	using Node_Allocator = typename Node_Traits::Allocator;
+
+	static_assert(
+	    std::is_same_v<typename Node_Traits::Pointer, Node *>,
+	    "The nodes link to each other with raw pointers");
+
+	template<bool Is_Const>
+	class Iterator_Detail
+	{
+	 private:
+		using Node_Pointer = std::conditional_t<Is_Const, Node const *, Node *>;
+		using Reference    = std::conditional_t<Is_Const, Value_t const &, Value_t &>;
+		using Pointer      = std::conditional_t<Is_Const, Value_t const *, Value_t *>;
+
+	 public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = Value_t;
+		using reference         = Reference;
+		using pointer           = Pointer;
+
+		Iterator_Detail() = default;
+
+		Iterator_Detail(Node_Pointer node, std::size_t index)
+		    : m_node(node)
+		    , m_index(index) {
+		}
+
+		/// @brief Allows converting an Iterator into a Const_Iterator
+		operator Iterator_Detail<true>() const
+		    requires(!Is_Const)
+		{
+			return {m_node, m_index};
+		}
+
+		Iterator_Detail &operator++() {
+			if (++m_index == m_node->m_count)
+			{
+				m_node  = m_node->m_next;
+				m_index = 0;
+			}
+			return *this;
+		}
+
+		Iterator_Detail operator++(int) {
+			Iterator_Detail iterator = *this;
+			++*this;
+			return iterator;
+		}
+
+		bool operator==(Iterator_Detail const &iterator) const = default;
+
+		Reference operator*() const {
+			return m_node->m_values[m_index];
+		}
+
+		Pointer operator->() const {
+			return std::addressof(m_node->m_values[m_index]);
+		}
+
+	 private:
+		Node_Pointer m_node  = nullptr;
+		std::size_t  m_index = 0;
+	};
+
+	/// @brief A node and the index of an element within it, along with the
+	/// node before it, which is null for the first node
+	struct Position
+	{
+		Node       *m_previous = nullptr;
+		Node       *m_node     = nullptr;
+		std::size_t m_index    = 0;
+	};
+
+ public:
+	using Allocator       = Allocator_t;
+	using Value           = Value_t;
+	using Reference       = Value_t &;
+	using Const_Reference = Value_t const &;
+	using Iterator        = Iterator_Detail<false>;
+	using Const_Iterator  = Iterator_Detail<true>;
+
+	/**
+	 * @brief Constructs an empty list, which allocates no nodes until the
+	 * first insertion
+	 */
+	explicit Unrolled_List(Allocator const &allocator = Allocator()) : m_allocator(allocator) {
+	}
+
+	/**
+	 * @brief Constructs a list filled with the given values
+	 */
+	Unrolled_List(
+	    std::initializer_list<Value_t> values,
+	    Allocator const               &allocator = Allocator())
+	    : m_allocator(allocator) {
+		for (auto const &value : values)
+		{
+			append(value);
+		}
+	}
+
+	~Unrolled_List() {
+		clear();
+	}
+
+	Unrolled_List(Unrolled_List const &list)
+	    : m_allocator(Node_Traits::propogate_or_create_instance(list.m_allocator)) {
+		for (auto const &value : list)
+		{
+			append(value);
+		}
+	}
+
+	Unrolled_List(Unrolled_List &&list) noexcept
+	    : m_allocator(std::move(list.m_allocator))
+	    , m_head(std::exchange(list.m_head, nullptr))
+	    , m_tail(std::exchange(list.m_tail, nullptr))
+	    , m_size(std::exchange(list.m_size, 0)) {
+	}
+
+	friend void swap(Unrolled_List &lhs, Unrolled_List &rhs) noexcept {
+		using std::swap;
+		swap(lhs.m_allocator, rhs.m_allocator);
+		swap(lhs.m_head, rhs.m_head);
+		swap(lhs.m_tail, rhs.m_tail);
+		swap(lhs.m_size, rhs.m_size);
+	}
+
+	auto operator=(Unrolled_List list) noexcept -> Unrolled_List & {
+		swap(*this, list);
+		return *this;
+	}
+
+	[[nodiscard]] auto begin() -> Iterator {
+		return Iterator(m_head, 0);
+	}
+
+	[[nodiscard]] auto begin() const -> Const_Iterator {
+		return Const_Iterator(m_head, 0);
+	}
+
+	[[nodiscard]] auto end() -> Iterator {
+		return Iterator(nullptr, 0);
+	}
+
+	[[nodiscard]] auto end() const -> Const_Iterator {
+		return Const_Iterator(nullptr, 0);
+	}
+
+	/**
+	 * @brief Gets the number of elements currently in the list
+	 */
+	[[nodiscard]] auto size() const -> std::size_t {
+		return m_size;
+	}
+
+	/**
+	 * @brief Gets the number of elements which fit in a node
+	 */
+	[[nodiscard]] static constexpr auto node_capacity() -> std::size_t {
+		return Node_Capacity;
+	}
+
+	/**
+	 * @brief Returns true if the list contains no elements
+	 */
+	[[nodiscard]] auto empty() const -> bool {
+		return m_head == nullptr;
+	}
+
+	/**
+	 * @brief Gets the first element in the list. This is undefined
+	 * behaviour if the list is empty
+	 */
+	[[nodiscard]] auto front() -> Reference {
+		return m_head->m_values[0];
+	}
+
+	/**
+	 * @brief Gets the first element in the list. This is undefined
+	 * behaviour if the list is empty
+	 */
+	[[nodiscard]] auto front() const -> Const_Reference {
+		return m_head->m_values[0];
+	}
+
+	/**
+	 * @brief Gets the last element in the list. This is undefined
+	 * behaviour if the list is empty
+	 */
+	[[nodiscard]] auto back() -> Reference {
+		return m_tail->m_values[m_tail->m_count - 1];
+	}
+
+	/**
+	 * @brief Gets the last element in the list. This is undefined
+	 * behaviour if the list is empty
+	 */
+	[[nodiscard]] auto back() const -> Const_Reference {
+		return m_tail->m_values[m_tail->m_count - 1];
+	}
+
+	/**
+	 * @brief Clears all elements from the list
+	 */
+	void clear() {
+		Node *node = m_head;
+		while (node != nullptr)
+		{
+			Node *next = node->m_next;
+			destroy_node(node);
+			node = next;
+		}
+		m_head = nullptr;
+		m_tail = nullptr;
+		m_size = 0;
+	}
+
+	/**
+	 * @brief Inserts the given value at the front of the list
+	 */
+	void prepend(Value_t value) {
+		emplace_at({nullptr, m_head, 0}, std::move(value));
+	}
+
+	/**
+	 * @brief Inserts the given value at the back of the list
+	 */
+	void append(Value_t value) {
+		emplace_back(std::move(value));
+	}
+
+	/**
+	 * @brief Constructs a value at the back of the list from the given
+	 * arguments. Appending fills the last node before allocating another,
+	 * so a list built by appending has full nodes
+	 */
+	template<typename... Arguments>
+	auto emplace_back(Arguments &&...arguments) -> Reference {
+		if (m_tail == nullptr || m_tail->m_count == Node_Capacity)
+		{
+			link_after(m_tail, create_node());
+		}
+		return emplace_end(m_tail, std::forward<Arguments>(arguments)...);
+	}
+
+	/**
+	 * @brief Inserts the given value at the given index. The behaviour is
+	 * undefined if the index is outside of the range: [0, size()]
+	 */
+	void insert(std::size_t index, Value_t value) {
+		emplace(index, std::move(value));
+	}
+
+	/**
+	 * @brief Constructs a value at the given index from the given
+	 * arguments. When the index falls at the end of a node with room left
+	 * the value is built directly inside of it. Otherwise elements have to
+	 * move, so the value is built first and then moved into place. The
+	 * behaviour is undefined if the index is outside of the range:
+	 * [0, size()]
+	 */
+	template<typename... Arguments>
+	auto emplace(std::size_t index, Arguments &&...arguments) -> Reference {
+		if (index == m_size)
+		{
+			return emplace_back(std::forward<Arguments>(arguments)...);
+		}
+
+		Position const position = find(index);
+		Node *const    previous = position.m_previous;
+		if (position.m_index == 0 && previous != nullptr && previous->m_count < Node_Capacity)
+		{
+			return emplace_end(previous, std::forward<Arguments>(arguments)...);
+		}
+		return emplace_at(position, std::forward<Arguments>(arguments)...);
+	}
+
+	/**
+	 * @brief Erases the value at the front of the list. The behaviour is
+	 * undefined if the list is empty
+	 */
+	void detatch_front() {
+		erase_at({nullptr, m_head, 0});
+	}
+
+	/**
+	 * @brief Erases the value at the given index. The behaviour is
+	 * undefined if the index is outside of the list size.
+	 */
+	void erase(std::size_t index) {
+		erase_at(find(index));
+	}
+
+	friend bool operator==(Unrolled_List const &lhs, Unrolled_List const &rhs) noexcept {
+		return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	friend bool operator!=(Unrolled_List const &lhs, Unrolled_List const &rhs) noexcept {
+		return !(lhs == rhs);
+	}
+
+ private:
+	Node_Allocator m_allocator;
+	Node          *m_head = nullptr;
+	Node          *m_tail = nullptr;
+	std::size_t    m_size = 0;
+
+	Node *create_node() {
+		Node *node = Node_Traits::allocate(m_allocator, 1);
+		Node_Traits::construct(m_allocator, node);
+		return node;
+	}
+
+	void destroy_node(Node *node) {
+		std::destroy_n(node->m_values.data(), node->m_count);
+		Node_Traits::destroy(m_allocator, node);
+		Node_Traits::deallocate(m_allocator, node, 1);
+	}
+
+	void link_after(Node *previous, Node *node) {
+		Node *&next  = previous == nullptr ? m_head : previous->m_next;
+		node->m_next = next;
+		next         = node;
+		if (previous == m_tail)
+		{
+			m_tail = node;
+		}
+	}
+
+	void unlink_after(Node *previous, Node *node) {
+		(previous == nullptr ? m_head : previous->m_next) = node->m_next;
+		if (node == m_tail)
+		{
+			m_tail = previous;
+		}
+		destroy_node(node);
+	}
+
+	/**
+	 * @brief Finds the node holding the element at the given index, skipping
+	 * over whole nodes. The behaviour is undefined if the index is outside of
+	 * the list size
+	 */
+	auto find(std::size_t index) -> Position {
+		Position position{nullptr, m_head, index};
+		while (position.m_index >= position.m_node->m_count)
+		{
+			position.m_index   -= position.m_node->m_count;
+			position.m_previous = position.m_node;
+			position.m_node     = position.m_node->m_next;
+		}
+		return position;
+	}
+
+	/**
+	 * @brief Constructs a value after the last element of a node which is
+	 * not full
+	 */
+	template<typename... Arguments>
+	auto emplace_end(Node *node, Arguments &&...arguments) -> Reference {
+		Value_t *value = std::construct_at(
+		    node->m_values.data() + node->m_count,
+		    std::forward<Arguments>(arguments)...);
+		++node->m_count;
+		++m_size;
+		return *value;
+	}
+
+	/**
+	 * @brief Constructs a value before the element at the position, or at
+	 * the end of the node if the index is its count. A full node first moves
+	 * its upper half into a new node after it
+	 */
+	template<typename... Arguments>
+	auto emplace_at(Position position, Arguments &&...arguments) -> Reference {
+		// The value is built before any element moves, as the arguments may
+		// refer to an element of the list
+		Value_t value(std::forward<Arguments>(arguments)...);
+
+		Node       *node  = position.m_node;
+		std::size_t index = position.m_index;
+		if (node == nullptr)
+		{
+			node = create_node();
+			link_after(position.m_previous, node);
+		}
+		else if (node->m_count == Node_Capacity)
+		{
+			std::size_t const half  = Node_Capacity / 2;
+			Node             *right = create_node();
+			uninitialized_relocate(
+			    node->m_values.data() + half,
+			    node->m_values.data() + Node_Capacity,
+			    right->m_values.data());
+			right->m_count = Node_Capacity - half;
+			node->m_count  = half;
+			link_after(node, right);
+
+			if (index > half)
+			{
+				node   = right;
+				index -= half;
+			}
+		}
+
+		Value_t *values = node->m_values.data();
+		detail::open_gap(values, node->m_count, index);
+		std::construct_at(values + index, std::move(value));
+		++node->m_count;
+		++m_size;
+		return values[index];
+	}
+
+	/**
+	 * @brief Erases the element at the position, then frees its node if it
+	 * is empty, or merges the next node into it if it is less than half full
+	 * and both fit in one node
+	 */
+	void erase_at(Position position) {
+		Node *node = position.m_node;
+		detail::close_gap(node->m_values.data(), node->m_count, position.m_index);
+		--node->m_count;
+		--m_size;
+
+		if (node->m_count == 0)
+		{
+			unlink_after(position.m_previous, node);
+			return;
+		}
+
+		Node *next = node->m_next;
+		if (node->m_count < Node_Capacity / 2 && next != nullptr
+		    && node->m_count + next->m_count <= Node_Capacity)
+		{
+			uninitialized_relocate(
+			    next->m_values.data(),
+			    next->m_values.data() + next->m_count,
+			    node->m_values.data() + node->m_count);
+			node->m_count += next->m_count;
+			next->m_count  = 0;
+			unlink_after(node, next);
+		}
+	}
+};
+
+} // namespace dsa
+
+#endif
@@ -3,9 +3,12 @@
 
 #include <dsa/allocator_traits.hpp>
 #include <dsa/default_allocator.hpp>
+#include <dsa/growth_policy.hpp>
 #include <dsa/memory.hpp>
+#include <dsa/type_traits.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <ostream>
@@ -24,15 +27,17 @@ namespace dsa
  * @tparam Value_t: The type of element to store
  * @tparam Pointer_Base: The type of pointer used to refer to memory
  * @tparam Allocator_Base: The type of allocator used for memory management
+ * @tparam Growth_Policy_t: Decides how the capacity changes as the size does
  *
  */
-template<typename Value_t, typename Allocator_t = Default_Allocator<Value_t>>
+template<typename Value_t, typename Allocator_t = Default_Allocator<Value_t>, typename Growth_Policy_t = Default_Growth_Policy>
 class Vector
 {
  private:
 	using Alloc_Traits = Allocator_Traits<Allocator_t>;
 
  public:
+	using Growth_Policy   = Growth_Policy_t;
 	using Allocator       = typename Alloc_Traits::Allocator;
 	using Value           = typename Alloc_Traits::Value;
 	using Reference       = typename Alloc_Traits::Reference;
@@ -272,9 +277,25 @@ class Vector
 	 * @brief Inserts the given value at the end of the vector
 	 */
 	void append(Value value) {
-		grow();
-		Alloc_Traits::construct(m_allocator, end(), std::move(value));
-		m_size++;
+		emplace_back(std::move(value));
+	}
+
+	/**
+	 * @brief Constructs a value at the end of the vector from the given
+	 * arguments
+	 */
+	template<typename... Arguments>
+	Reference emplace_back(Arguments &&...arguments) {
+		return emplace(size(), std::forward<Arguments>(arguments)...);
+	}
+
+	/**
+	 * @brief Inserts copies of the values in [first, last) at the end of the
+	 * vector. The storage is grown at most once
+	 */
+	template<Sized_Input_Iterator Iterator_t>
+	void append_range(Iterator_t first, Iterator_t last) {
+		insert_range(size(), first, last);
 	}
 
 	/**
@@ -282,17 +303,30 @@ class Vector
 	 * undefined if the index is outside of the range: [0, size()]
 	 */
 	void insert(std::size_t index, Value value) {
-		using std::swap;
+		emplace(index, std::move(value));
+	}
 
-		if (should_grow())
+	/**
+	 * @brief Constructs a value at the given index from the given
+	 * arguments, directly in its final storage. The behaviour is undefined
+	 * if the index is outside of the range: [0, size()]
+	 */
+	template<typename... Arguments>
+	Reference emplace(std::size_t index, Arguments &&...arguments) {
+		if (should_grow() && !expand_in_place(grow_size()))
 		{
+			// The value is constructed before relocating so that the
+			// arguments may refer to elements held by the vector
 			size_t  capacity     = grow_size();
 			Pointer storage      = Alloc_Traits::allocate(m_allocator, capacity);
 			Pointer insert_point = storage + index;
 			Pointer rest         = insert_point + 1;
-			Alloc_Traits::construct(m_allocator, insert_point, std::move(value));
-			uninitialized_move(begin(), begin() + index, storage);
-			uninitialized_move(begin() + index, end(), rest);
+			Alloc_Traits::construct(
+			    m_allocator,
+			    insert_point,
+			    std::forward<Arguments>(arguments)...);
+			uninitialized_relocate(begin(), begin() + index, storage);
+			uninitialized_relocate(begin() + index, end(), rest);
 			Alloc_Traits::deallocate(m_allocator, m_storage, m_capacity);
 			m_storage  = storage;
 			m_capacity = capacity;
@@ -300,12 +334,70 @@ class Vector
 		else
 		{
 			Pointer insert_point = begin() + index;
-			uninitialized_shift(insert_point, end());
-
-			Alloc_Traits::construct(m_allocator, insert_point, std::move(value));
+			if (insert_point == end())
+			{
+				Alloc_Traits::construct(
+				    m_allocator,
+				    insert_point,
+				    std::forward<Arguments>(arguments)...);
+			}
+			else
+			{
+				// Shifting would move any element the arguments refer
+				// to, so the value is built before making room for it
+				Value value(std::forward<Arguments>(arguments)...);
+				uninitialized_shift(insert_point, end());
+				Alloc_Traits::construct(
+				    m_allocator,
+				    insert_point,
+				    std::move(value));
+			}
 		}
 
 		m_size++;
+		return m_storage[index];
+	}
+
+	/**
+	 * @brief Inserts copies of the values in [first, last) starting at the
+	 * given index. The storage is grown at most once and the following
+	 * elements are shifted only once. The values may be elements of the
+	 * vector itself. The behaviour is undefined if the index is outside of
+	 * the range: [0, size()]
+	 */
+	template<Sized_Input_Iterator Iterator_t>
+	void insert_range(std::size_t index, Iterator_t first, Iterator_t last) {
+		auto const count = static_cast<std::size_t>(std::ranges::distance(first, last));
+		if (count == 0)
+		{
+			return;
+		}
+
+		std::size_t const new_size = size() + count;
+		if (new_size > capacity() && !expand_in_place(std::max(new_size, grow_size())))
+		{
+			size_t  capacity     = std::max(new_size, grow_size());
+			Pointer storage      = Alloc_Traits::allocate(m_allocator, capacity);
+			Pointer insert_point = storage + index;
+			std::uninitialized_copy(first, last, insert_point);
+			uninitialized_relocate(begin(), begin() + index, storage);
+			uninitialized_relocate(begin() + index, end(), insert_point + count);
+			Alloc_Traits::deallocate(m_allocator, m_storage, m_capacity);
+			m_storage  = storage;
+			m_capacity = capacity;
+		}
+		else
+		{
+			// The values may refer to elements of the vector, so they
+			// are copied into the spare capacity before any element
+			// moves, and then rotated into place
+			Pointer insert_point = begin() + index;
+			Pointer old_end      = end();
+			std::uninitialized_copy(first, last, old_end);
+			std::rotate(insert_point, old_end, old_end + static_cast<std::ptrdiff_t>(count));
+		}
+
+		m_size = new_size;
 	}
 
 	/**
@@ -313,26 +405,41 @@ class Vector
 	 * undefined if the index is outside of the vector size.
 	 */
 	void erase(std::size_t index) {
-		using std::swap;
+		erase_range(index, index + 1);
+	}
+
+	/**
+	 * @brief Erases the values in the index range [first, last). The
+	 * following elements are shifted only once. The behaviour is undefined
+	 * if the range is not within the vector size
+	 */
+	void erase_range(std::size_t first, std::size_t last) {
+		std::size_t const count = last - first;
+		if (count == 0)
+		{
+			return;
+		}
 
-		Pointer erasing = begin() + index;
-		Alloc_Traits::destroy(m_allocator, erasing);
+		Pointer erasing = begin() + first;
+		Pointer rest    = begin() + last;
+		std::destroy(erasing, rest);
 
-		if (should_shrink())
+		std::size_t const capacity =
+		    Growth_Policy::shrink_capacity(size() - count, m_capacity);
+		if (capacity != m_capacity)
 		{
-			size_t  capacity = shrink_size();
-			Pointer storage  = Alloc_Traits::allocate(m_allocator, capacity);
-			uninitialized_move(begin(), erasing, storage);
-			uninitialized_move(erasing + 1, end(), storage + index);
+			Pointer storage = Alloc_Traits::allocate(m_allocator, capacity);
+			uninitialized_relocate(begin(), erasing, storage);
+			uninitialized_relocate(rest, end(), storage + first);
 			Alloc_Traits::deallocate(m_allocator, m_storage, m_capacity);
 			m_storage  = storage;
 			m_capacity = capacity;
 		}
-		else
+		else if (rest != end())
 		{
-			uninitialized_shift(erasing + 1, end(), -1);
+			uninitialized_shift(rest, end(), -static_cast<std::ptrdiff_t>(count));
 		}
-		m_size--;
+		m_size -= count;
 	}
 
 	/**
@@ -340,27 +447,27 @@ class Vector
 	 * the elements held
 	 */
 	void shrink_to_fit() {
-		using std::swap;
-
-		size_t  capacity = m_size;
-		Pointer storage  = Alloc_Traits::allocate(m_allocator, capacity);
-		uninitialized_move(begin(), end(), storage);
-		Alloc_Traits::deallocate(m_allocator, m_storage, m_capacity);
-		m_storage  = storage;
-		m_capacity = capacity;
+		reallocate(m_size);
 	}
 
 	/**
 	 * @brief Resizes the vector to contain the given amount of elements.
 	 * If the new size is larger than the old, new elements are default
-	 * initialised
+	 * initialised. If it is smaller, the growth policy decides whether the
+	 * excess memory is given back
 	 */
 	void resize(std::size_t new_size) {
 		if (new_size < size())
 		{
 			std::destroy(begin() + new_size, end());
 			m_size = new_size;
-			shrink_to_fit();
+
+			std::size_t const capacity =
+			    Growth_Policy::shrink_capacity(m_size, m_capacity);
+			if (capacity != m_capacity)
+			{
+				reallocate(capacity);
+			}
 			return;
 		}
 
@@ -379,18 +486,12 @@ class Vector
 	 * number of elements without having to resize
 	 */
 	void reserve(std::size_t new_capacity) {
-		using std::swap;
-
-		if (capacity() >= new_capacity)
+		if (capacity() >= new_capacity || expand_in_place(new_capacity))
 		{
 			return;
 		}
 
-		Pointer storage = Alloc_Traits::allocate(m_allocator, new_capacity);
-		uninitialized_move(begin(), end(), storage);
-		Alloc_Traits::deallocate(m_allocator, m_storage, m_capacity);
-		m_storage  = storage;
-		m_capacity = new_capacity;
+		reallocate(new_capacity);
 	}
 
  private:
@@ -407,27 +508,35 @@ class Vector
 		return size() >= capacity();
 	}
 
-	void grow() {
-		if (should_grow())
+	/**
+	 * @brief Tries to grow the current allocation without relocating the
+	 * elements held. Returns false if the allocator could not do so.
+	 */
+	[[nodiscard]] bool expand_in_place(std::size_t capacity) {
+		if (data() == nullptr
+		    || !Alloc_Traits::expand_in_place(m_allocator, m_storage, m_capacity, capacity))
 		{
-			reserve(grow_size());
+			return false;
 		}
+
+		m_capacity = capacity;
+		return true;
 	}
 
 	[[nodiscard]] std::size_t grow_size() {
-		return std::max(1ULL, 2ULL * capacity());
+		return Growth_Policy::grow_capacity(capacity());
 	}
 
 	/**
-	 * @brief Returns whether the vector should shrink after removing a
-	 * single element from it
+	 * @brief Moves the held elements into a new allocation of the given
+	 * capacity, which must be large enough to hold them
 	 */
-	[[nodiscard]] bool should_shrink() {
-		return capacity() / 4ULL >= size() - 1;
-	}
-
-	[[nodiscard]] std::size_t shrink_size() {
-		return capacity() / 2ULL;
+	void reallocate(std::size_t new_capacity) {
+		Pointer storage = Alloc_Traits::allocate(m_allocator, new_capacity);
+		uninitialized_relocate(begin(), end(), storage);
+		Alloc_Traits::deallocate(m_allocator, m_storage, m_capacity);
+		m_storage  = storage;
+		m_capacity = new_capacity;
 	}
 };
 
@@ -0,0 +1,384 @@
+#ifndef DSA_WORK_STEALING_POOL_HPP
+#define DSA_WORK_STEALING_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dsa
+{
+
+/**
+ * @brief Runs tasks on a fixed set of worker threads. Every worker owns a
+ * queue: tasks submitted from a worker are pushed onto its own queue and
+ * taken back in last in first out order, which keeps recently split work hot
+ * in the cache. Idle workers steal the oldest task of another queue, which
+ * for recursive algorithms tends to be the largest piece of work left.
+ *
+ * A thread in invoke takes its second function back and runs it inline
+ * unless it was stolen in the meantime. A worker whose function was stolen
+ * only helps with the tasks queued by the thief, which are part of the
+ * stolen function, so its stack grows no deeper than the work it waits for.
+ * Other threads block until the thief finishes. Nested fork join parallelism
+ * therefore works with any number of workers, a pool without workers runs
+ * everything inline in invoke.
+ */
+class Work_Stealing_Pool
+{
+ public:
+	using Task = std::function<void()>;
+
+	/**
+	 * @brief Returns the number of threads the hardware can run at once,
+	 * or one if that is unknown
+	 */
+	[[nodiscard]] static std::size_t default_thread_count() {
+		return std::max(1U, std::thread::hardware_concurrency());
+	}
+
+	/**
+	 * @brief Starts the given number of worker threads
+	 */
+	explicit Work_Stealing_Pool(std::size_t thread_count = default_thread_count())
+	    : m_queue_count(std::max<std::size_t>(thread_count, 1))
+	    , m_queues(std::make_unique<Queue[]>(m_queue_count)) {
+		m_threads.reserve(thread_count);
+		for (std::size_t index = 0; index < thread_count; ++index)
+		{
+			m_threads.emplace_back([this, index] { work(index); });
+		}
+	}
+
+	/**
+	 * @brief Joins the workers and runs the tasks which are still pending on
+	 * the calling thread
+	 */
+	~Work_Stealing_Pool() {
+		{
+			std::lock_guard lock(m_sleep_mutex);
+			m_stopping = true;
+		}
+		m_wake.notify_all();
+
+		for (std::thread &thread : m_threads)
+		{
+			thread.join();
+		}
+
+		while (try_run_one())
+		{
+		}
+	}
+
+	Work_Stealing_Pool(Work_Stealing_Pool const &)            = delete;
+	Work_Stealing_Pool &operator=(Work_Stealing_Pool const &) = delete;
+	Work_Stealing_Pool(Work_Stealing_Pool &&)                 = delete;
+	Work_Stealing_Pool &operator=(Work_Stealing_Pool &&)      = delete;
+
+	/**
+	 * @brief Returns the number of worker threads
+	 */
+	[[nodiscard]] std::size_t thread_count() const {
+		return m_threads.size();
+	}
+
+	/**
+	 * @brief Queues a task to be run by one of the workers
+	 */
+	void submit(Task task) {
+		push(current_index().value_or(next_queue()), {std::move(task), nullptr});
+	}
+
+	/**
+	 * @brief Runs one pending task on the calling thread, preferring the
+	 * most recent task of its own queue over stealing from others
+	 * @return false if no task was pending
+	 */
+	bool try_run_one() {
+		Task task = take();
+		if (!task)
+		{
+			return false;
+		}
+
+		task();
+		return true;
+	}
+
+	/**
+	 * @brief Runs both functions, possibly in parallel, and returns once
+	 * both have finished. The second function is offered to the pool while
+	 * the calling thread runs the first one. If either function throws, the
+	 * exception is rethrown once both have finished
+	 */
+	template<typename First, typename Second>
+	void invoke(First &&first, Second &&second) {
+		std::optional<std::size_t> const own   = current_index();
+		std::size_t const                 index = own.value_or(next_queue());
+
+		Join join;
+		push(index,
+		     {[&second, &join] {
+			      std::exception_ptr error = capture(second);
+
+			      // The waiting thread destroys the join once it can lock
+			      // the mutex, so it is notified before the lock is released
+			      std::lock_guard lock(join.m_mutex);
+			      join.m_error = error;
+			      join.m_done.store(true, std::memory_order_release);
+			      join.m_finished.notify_all();
+		      },
+		      &join});
+
+		std::exception_ptr const first_error = capture(first);
+
+		if (reclaim(index, join))
+		{
+			join.m_error = capture(second);
+		}
+		else
+		{
+			wait(own, join);
+		}
+
+		if (first_error)
+		{
+			std::rethrow_exception(first_error);
+		}
+
+		if (join.m_error)
+		{
+			std::rethrow_exception(join.m_error);
+		}
+	}
+
+ private:
+	static constexpr std::size_t no_thief = static_cast<std::size_t>(-1);
+
+	/// @brief Tracks the second function of an invoke
+	struct Join
+	{
+		std::mutex              m_mutex;
+		std::condition_variable m_finished;
+		std::atomic<bool>       m_done = false;
+		std::exception_ptr      m_error;
+
+		/// @brief The worker which took the task, written under the
+		/// lock of the queue it was taken from
+		std::size_t m_thief = no_thief;
+	};
+
+	struct Entry
+	{
+		Task  m_task;
+		Join *m_join = nullptr;
+	};
+
+	struct Queue
+	{
+		std::mutex        m_mutex;
+		std::deque<Entry> m_entries;
+	};
+
+	/// @brief Identifies the pool and queue of the worker running on the
+	/// current thread
+	struct Worker_Identity
+	{
+		Work_Stealing_Pool const *m_pool  = nullptr;
+		std::size_t               m_index = 0;
+	};
+
+	static Worker_Identity &current_worker() {
+		thread_local Worker_Identity identity;
+		return identity;
+	}
+
+	template<typename Function>
+	static std::exception_ptr capture(Function &function) {
+		try
+		{
+			function();
+		}
+		catch (...)
+		{
+			return std::current_exception();
+		}
+		return {};
+	}
+
+	std::size_t              m_queue_count;
+	std::unique_ptr<Queue[]> m_queues;
+	std::vector<std::thread> m_threads;
+	std::atomic<std::size_t> m_next_queue = 0;
+	std::atomic<std::size_t> m_pending    = 0;
+	std::mutex               m_sleep_mutex;
+	std::condition_variable  m_wake;
+	bool                     m_stopping = false;
+
+	[[nodiscard]] std::optional<std::size_t> current_index() const {
+		Worker_Identity const &identity = current_worker();
+		if (identity.m_pool != this)
+		{
+			return {};
+		}
+		return identity.m_index;
+	}
+
+	std::size_t next_queue() {
+		return m_next_queue.fetch_add(1, std::memory_order_relaxed) % m_queue_count;
+	}
+
+	void push(std::size_t index, Entry entry) {
+		Queue &queue = m_queues[index];
+		{
+			std::lock_guard lock(queue.m_mutex);
+			queue.m_entries.push_back(std::move(entry));
+		}
+
+		// Taking the lock orders the increment before a worker which is
+		// about to sleep checks for pending tasks
+		m_pending.fetch_add(1, std::memory_order_release);
+		{
+			std::lock_guard lock(m_sleep_mutex);
+		}
+		m_wake.notify_one();
+	}
+
+	/**
+	 * @brief Removes the task of the join from the queue it was pushed to
+	 * @return false if the task was taken by another thread
+	 */
+	bool reclaim(std::size_t index, Join const &join) {
+		Queue          &queue = m_queues[index];
+		std::lock_guard lock(queue.m_mutex);
+
+		auto entry = std::find_if(
+		    queue.m_entries.rbegin(),
+		    queue.m_entries.rend(),
+		    [&join](Entry const &candidate) { return candidate.m_join == &join; });
+		if (entry == queue.m_entries.rend())
+		{
+			return false;
+		}
+
+		queue.m_entries.erase(std::next(entry).base());
+		taken();
+		return true;
+	}
+
+	void wait(std::optional<std::size_t> own, Join &join) {
+		if (own.has_value())
+		{
+			while (!join.m_done.load(std::memory_order_acquire))
+			{
+				if (join.m_thief == no_thief || !run_oldest(join.m_thief))
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+
+		std::unique_lock lock(join.m_mutex);
+		join.m_finished.wait(
+		    lock,
+		    [&join] { return join.m_done.load(std::memory_order_relaxed); });
+	}
+
+	bool run_oldest(std::size_t index) {
+		Task task = take_oldest(index);
+		if (!task)
+		{
+			return false;
+		}
+
+		task();
+		return true;
+	}
+
+	Task take() {
+		std::optional<std::size_t> const own = current_index();
+		if (own.has_value())
+		{
+			Queue          &queue = m_queues[own.value()];
+			std::lock_guard lock(queue.m_mutex);
+			if (!queue.m_entries.empty())
+			{
+				Entry entry = std::move(queue.m_entries.back());
+				queue.m_entries.pop_back();
+				return taken(std::move(entry));
+			}
+		}
+
+		std::size_t const first = own.has_value() ? own.value() + 1 : next_queue();
+		for (std::size_t offset = 0; offset < m_queue_count; ++offset)
+		{
+			Task task = take_oldest((first + offset) % m_queue_count);
+			if (task)
+			{
+				return task;
+			}
+		}
+		return {};
+	}
+
+	Task take_oldest(std::size_t index) {
+		Queue          &queue = m_queues[index];
+		std::lock_guard lock(queue.m_mutex);
+		if (queue.m_entries.empty())
+		{
+			return {};
+		}
+
+		Entry entry = std::move(queue.m_entries.front());
+		queue.m_entries.pop_front();
+		return taken(std::move(entry));
+	}
+
+	/// @brief Records the calling thread as the thief of the entry, must be
+	/// called while holding the lock of the queue it was taken from
+	Task taken(Entry entry) {
+		if (entry.m_join != nullptr)
+		{
+			entry.m_join->m_thief = current_index().value_or(no_thief);
+		}
+		taken();
+		return std::move(entry.m_task);
+	}
+
+	void taken() {
+		m_pending.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	void work(std::size_t index) {
+		current_worker() = {this, index};
+
+		while (true)
+		{
+			if (try_run_one())
+			{
+				continue;
+			}
+
+			std::unique_lock lock(m_sleep_mutex);
+			m_wake.wait(lock, [this] { return m_stopping || m_pending.load() > 0; });
+			if (m_stopping && m_pending.load() == 0)
+			{
+				return;
+			}
+		}
+	}
+};
+
+} // namespace dsa
+
+#endif
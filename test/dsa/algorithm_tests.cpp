@@ -4,11 +4,20 @@
 
 #include <dsa/algorithms.hpp>
 #include <dsa/dynamic_array.hpp>
+#include <dsa/hash_map.hpp>
 #include <dsa/memory.hpp>
 #include <dsa/memory_monitor.hpp>
+#include <dsa/monotonic_buffer.hpp>
 
+#include <algorithm>
 #include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <string>
+#include <utility>
 
 #include <catch2/catch_all.hpp>
 
@@ -345,6 +354,183 @@ TEST_CASE("Merge sort correctly sorts an array", "[algorithms]") {
 	}
 }
 
+TEST_CASE("Merge sort sorts ranges longer than its insertion sort runs", "[algorithms]") {
+	dsa::Dynamic_Array<int> array(100);
+	for (std::size_t i = 0; i < array.size(); ++i)
+	{
+		array[i] = static_cast<int>((i * 37) % array.size());
+	}
+
+	SECTION("All the temporaries are allocated from a monotonic buffer") {
+		dsa::Monotonic_Buffer<> buffer(array.size() / 2 * sizeof(int));
+		dsa::merge_sort(array.begin(), array.end(), std::less{}, buffer);
+
+		REQUIRE(dsa::is_sorted(array.begin(), array.end()));
+		REQUIRE(buffer.capacity() == array.size() / 2 * sizeof(int));
+	}
+
+	SECTION("The temporaries can be allocated by the allocator of the elements") {
+		using Allocator = dsa::Memory_Monitor<int, Allocation_Verifier>;
+
+		Memory_Monitor_Handler_Scope<Allocation_Verifier> scope;
+		dsa::Dynamic_Array<int, Allocator>                 monitored(array.size(), 0, Allocator());
+		std::copy(array.begin(), array.end(), monitored.begin());
+
+		dsa::merge_sort<decltype(monitored.begin()), Allocator>(monitored.begin(), monitored.end());
+
+		REQUIRE(dsa::is_sorted(monitored.begin(), monitored.end()));
+	}
+
+	SECTION("Equal elements keep their relative order") {
+		dsa::Dynamic_Array<std::pair<int, int>> pairs(array.size());
+		for (std::size_t i = 0; i < pairs.size(); ++i)
+		{
+			pairs[i] = {array[i] % 7, static_cast<int>(i)};
+		}
+
+		auto by_key = [](auto const &lhs, auto const &rhs) {
+			return lhs.first < rhs.first;
+		};
+		dsa::merge_sort(pairs.begin(), pairs.end(), by_key);
+
+		REQUIRE(dsa::is_sorted(pairs.begin(), pairs.end(), std::less{}));
+	}
+}
+
+TEST_CASE("Heap sort correctly sorts an array", "[algorithms]") {
+	SECTION("An empty array is already sorted") {
+		dsa::Dynamic_Array<int> array;
+
+		dsa::heap_sort(array.begin(), array.end());
+
+		REQUIRE(dsa::is_sorted(array.begin(), array.end()));
+	}
+
+	SECTION("Multiple elements are correctly sorted") {
+		dsa::Dynamic_Array array{9, 3, 8, 2, 1, 7, 5, 6, 4, 10};
+
+		dsa::heap_sort(array.begin(), array.end());
+
+		REQUIRE(dsa::is_sorted(array.begin(), array.end()));
+	}
+
+	SECTION("Can sort an array in descending order") {
+		dsa::Dynamic_Array array{9, 3, 8, 2, 1, 7, 5, 6, 4, 10};
+
+		dsa::heap_sort(array.begin(), array.end(), std::greater{});
+
+		REQUIRE(dsa::is_sorted(array.begin(), array.end(), std::greater{}));
+	}
+}
+
+TEST_CASE("Quick sort correctly sorts an array", "[algorithms]") {
+	auto is_ascending = [](dsa::Dynamic_Array<int> const &array) {
+		return dsa::is_sorted(array.begin(), array.end(), std::less_equal{});
+	};
+
+	SECTION("An empty array is already sorted") {
+		dsa::Dynamic_Array<int> array;
+
+		dsa::quick_sort(array.begin(), array.end());
+
+		REQUIRE(is_ascending(array));
+	}
+
+	SECTION("A single element is already sorted") {
+		dsa::Dynamic_Array array{0};
+
+		dsa::quick_sort(array.begin(), array.end());
+
+		REQUIRE(is_ascending(array));
+	}
+
+	SECTION("Multiple elements are correctly sorted") {
+		dsa::Dynamic_Array array{9, 3, 8, 2, 1, 7, 5, 6, 4, 10};
+
+		dsa::quick_sort(array.begin(), array.end());
+
+		REQUIRE(is_ascending(array));
+	}
+
+	SECTION("Can sort an array in descending order") {
+		dsa::Dynamic_Array array{9, 3, 8, 2, 1, 7, 5, 6, 4, 10};
+
+		dsa::quick_sort(array.begin(), array.end(), std::greater{});
+
+		REQUIRE(dsa::is_sorted(array.begin(), array.end(), std::greater{}));
+	}
+
+	SECTION("Large arrays are partitioned before being sorted") {
+		std::size_t const size = GENERATE(17ULL, 100ULL, 129ULL, 1'000ULL);
+
+		auto sorts = [&](auto const &pattern) {
+			dsa::Dynamic_Array<int> array(size);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				array[i] = static_cast<int>(pattern(i));
+			}
+
+			dsa::quick_sort(array.begin(), array.end());
+			return is_ascending(array);
+		};
+
+		REQUIRE(sorts([&](std::size_t i) { return (i * 37) % size; }));
+		REQUIRE(sorts([&](std::size_t i) { return i % 3; }));
+		REQUIRE(sorts([&](std::size_t i) { return size - i; }));
+		REQUIRE(sorts([&](std::size_t i) { return i < size / 2 ? i : size - i; }));
+	}
+}
+
+TEST_CASE("Radix sort orders elements by their keys", "[algorithms]") {
+	SECTION("An empty array is already sorted") {
+		dsa::Dynamic_Array<unsigned> array;
+
+		dsa::radix_sort(array.begin(), array.end());
+
+		REQUIRE(array.size() == 0);
+	}
+
+	SECTION("Unsigned values are sorted") {
+		dsa::Dynamic_Array<unsigned> array{900, 3, 70'000, 2, 1, 7, 5, 0xFFFF'FFFF, 4, 10};
+
+		dsa::radix_sort(array.begin(), array.end());
+
+		REQUIRE(dsa::is_sorted(array.begin(), array.end()));
+	}
+
+	SECTION("Negative values are placed before positive ones") {
+		dsa::Dynamic_Array<long long> array{9, -3, 8, -2'000'000'000'000, 1, 0, -5, 6, -10};
+
+		dsa::radix_sort(array.begin(), array.end());
+
+		REQUIRE(dsa::is_sorted(array.begin(), array.end()));
+	}
+
+	SECTION("Floating point values are sorted") {
+		dsa::Dynamic_Array<double> array{9.5, -3.25, 8, -2e30, 1e-9, 0, -5, 6, 4, -1e-9};
+
+		dsa::radix_sort(array.begin(), array.end());
+
+		REQUIRE(dsa::is_sorted(array.begin(), array.end()));
+	}
+
+	SECTION("Elements with equal keys keep their relative order") {
+		dsa::Dynamic_Array<std::pair<short, int>> array(300);
+		for (std::size_t i = 0; i < array.size(); ++i)
+		{
+			auto const key = static_cast<short>(static_cast<int>(i * 37 % 11) - 5);
+			array[i]       = {key, static_cast<int>(i)};
+		}
+
+		auto key = [](auto const &pair) {
+			return pair.first;
+		};
+		dsa::radix_sort(array.begin(), array.end(), key);
+
+		REQUIRE(dsa::is_sorted(array.begin(), array.end(), std::less{}));
+	}
+}
+
 TEST_CASE("Linear search finds first occurence of element", "[algorithms]") {
 	SECTION("Search does not find element in empty array") {
 		dsa::Dynamic_Array<int> array;
@@ -417,6 +603,97 @@ TEST_CASE("Linear search finds first occurence of element", "[algorithms]") {
 	}
 }
 
+TEMPLATE_TEST_CASE(
+    "Linear search over arithmetic values finds the first occurence at every position",
+    "[algorithms]",
+    std::int8_t,
+    std::uint16_t,
+    int,
+    std::int64_t,
+    float,
+    double) {
+	// Long enough to cover a full AVX-512 register of bytes followed by a tail
+	constexpr std::size_t size = 150;
+
+	dsa::Dynamic_Array<TestType> array(size);
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		array[i] = static_cast<TestType>(i % 50);
+	}
+	auto const needle = static_cast<TestType>(-1);
+
+	REQUIRE_FALSE(dsa::linear_search(array.begin(), array.end(), needle).has_value());
+
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		TestType const previous = std::exchange(array[i], needle);
+		array[size - 1]         = needle;
+
+		auto element = dsa::linear_search(array.begin(), array.end(), needle);
+
+		REQUIRE(element.has_value());
+		REQUIRE(element.value() == array.begin() + i);
+
+		array[size - 1] = static_cast<TestType>((size - 1) % 50);
+		array[i]        = previous;
+	}
+}
+
+TEST_CASE("Linear search compares floating point values by value", "[algorithms]") {
+	dsa::Dynamic_Array<double> array(40, 1.0);
+	array[10] = std::numeric_limits<double>::quiet_NaN();
+	array[30] = -0.0;
+
+	SECTION("Negative zero is equal to zero") {
+		auto element = dsa::linear_search(array.begin(), array.end(), 0.0);
+
+		REQUIRE(element.has_value());
+		REQUIRE(element.value() == array.begin() + 30);
+	}
+
+	SECTION("NaN is equal to nothing") {
+		auto element =
+		    dsa::linear_search(array.begin(), array.end(), std::numeric_limits<double>::quiet_NaN());
+
+		REQUIRE_FALSE(element.has_value());
+	}
+}
+
+TEST_CASE("Lower bound finds the first element not less than a value", "[algorithms]") {
+	SECTION("Search returns end in an empty array") {
+		dsa::Dynamic_Array<int> array;
+
+		REQUIRE(dsa::lower_bound(array.begin(), array.end(), 0) == array.end());
+	}
+
+	SECTION("Search matches std::lower_bound on every length and value") {
+		for (std::size_t size = 0; size < 40; ++size)
+		{
+			dsa::Dynamic_Array<int> array(size);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				array[i] = static_cast<int>(i / 3 * 2);
+			}
+
+			for (int value = -1; value <= static_cast<int>(size); ++value)
+			{
+				auto element  = dsa::lower_bound(array.begin(), array.end(), value);
+				auto expected = std::lower_bound(array.begin(), array.end(), value);
+
+				REQUIRE(element == expected);
+			}
+		}
+	}
+
+	SECTION("Search supports a comparator argument") {
+		dsa::Dynamic_Array array{53, 45, 33, 31, 21};
+
+		auto element = dsa::lower_bound(array.begin(), array.end(), 40, std::greater{});
+
+		REQUIRE(element == array.begin() + 2);
+	}
+}
+
 TEST_CASE("Binary search searches an array for an element", "[algorithms]") {
 	SECTION("Search does not find element in empty array") {
 		dsa::Dynamic_Array<int> array;
@@ -478,6 +755,15 @@ TEST_CASE("Binary search searches an array for an element", "[algorithms]") {
 		REQUIRE(element.value() == array.begin());
 	}
 
+	SECTION("Search finds the first of equal elements") {
+		dsa::Dynamic_Array array{21, 31, 31, 31, 31, 45, 53};
+
+		auto element = dsa::binary_search(array.begin(), array.end(), 31);
+
+		REQUIRE(element.has_value());
+		REQUIRE(element.value() == array.begin() + 1);
+	}
+
 	SECTION("Search supports a predicate argument") {
 		dsa::Dynamic_Array array{
 		    Incomparable_Value(2),
@@ -567,6 +853,21 @@ TEST_CASE("Sum components search find two elements adding up to a sum", "[algori
 	}
 }
 
+TEST_CASE("Sum components search allocates from a monotonic buffer", "[algorithms]") {
+	using Iterator = dsa::Dynamic_Array<int>::Iterator;
+
+	dsa::Dynamic_Array array{7, 4, 3, 9, 1};
+
+	std::size_t const size = dsa::Hash_Map<int, Iterator>::allocation_size(array.size());
+
+	dsa::Monotonic_Buffer<> buffer(size);
+	auto pair = dsa::sum_components_search(array.begin(), array.end(), 7, buffer);
+
+	REQUIRE(pair.has_value());
+	REQUIRE(*pair.value().first + *pair.value().second == 7);
+	REQUIRE(buffer.capacity() == size);
+}
+
 TEST_CASE("Checks if two iterator ranges overlap", "[algorithms]") {
 	dsa::Dynamic_Array range{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
 	SECTION("No overlap for destination range before source range") {
@@ -589,7 +890,7 @@ TEST_CASE("Checks if two iterator ranges overlap", "[algorithms]") {
 TEST_CASE("Shift memory block onto overlapping partly uninitialized memory", "[algorithms]") {
 	std::allocator<int> allocator;
 
-	size_t count  = 7;
+	size_t count  = 8;
 	auto   memory = allocator.allocate(count);
 
 	memory[3] = 1;
@@ -613,4 +914,48 @@ TEST_CASE("Shift memory block onto overlapping partly uninitialized memory", "[a
 	allocator.deallocate(memory, count);
 }
 
+TEST_CASE("Relocate memory block into uninitialized memory", "[algorithms]") {
+	STATIC_REQUIRE(dsa::Is_Trivially_Relocatable_v<int>);
+	STATIC_REQUIRE_FALSE(dsa::Is_Trivially_Relocatable_v<std::string>);
+
+	SECTION("Trivially relocatable values are copied to the destination") {
+		std::allocator<int> allocator;
+
+		size_t count       = 3;
+		auto   source      = allocator.allocate(count);
+		auto   destination = allocator.allocate(count);
+
+		source[0] = 1;
+		source[1] = 2;
+		source[2] = 3;
+
+		dsa::uninitialized_relocate(source, source + count, destination);
+		REQUIRE(destination[0] == 1);
+		REQUIRE(destination[1] == 2);
+		REQUIRE(destination[2] == 3);
+
+		allocator.deallocate(source, count);
+		allocator.deallocate(destination, count);
+	}
+
+	SECTION("Non trivial values are moved to the destination") {
+		std::allocator<std::string> allocator;
+
+		size_t count       = 2;
+		auto   source      = allocator.allocate(count);
+		auto   destination = allocator.allocate(count);
+
+		std::construct_at(&source[0], "first");
+		std::construct_at(&source[1], "second");
+
+		dsa::uninitialized_relocate(source, source + count, destination);
+		REQUIRE(destination[0] == "first");
+		REQUIRE(destination[1] == "second");
+
+		std::destroy(destination, destination + count);
+		allocator.deallocate(source, count);
+		allocator.deallocate(destination, count);
+	}
+}
+
 } // namespace test
@@ -42,6 +42,14 @@ constexpr bool call_overloads() {
 	return true;
 }
 
+constexpr bool expand_in_place() {
+	Dummy_Value_Allocator allocator;
+	Dummy_Value          *pointer  = Traits::allocate(allocator, 1U);
+	bool const            expanded = Traits::expand_in_place(allocator, pointer, 1U, 2U);
+	Traits::deallocate(allocator, pointer, 1U);
+	return expanded;
+}
+
 } // namespace standard
 
 TEST_CASE(
@@ -50,6 +58,12 @@ TEST_CASE(
 	STATIC_REQUIRE(standard::call_overloads());
 }
 
+TEST_CASE(
+    "Allocator_Traits does not expand allocations in place unless the allocator supports it",
+    "[allocator_traits]") {
+	STATIC_REQUIRE_FALSE(standard::expand_in_place());
+}
+
 namespace custom
 {
 
@@ -80,6 +94,12 @@ struct Dummy_Allocator
 		destroyed = pointer.id();
 	}
 
+	constexpr bool expand_in_place(Pointer pointer, std::size_t /* count */, std::size_t new_count) {
+		expanded_count = new_count;
+		expanded       = pointer.id();
+		return true;
+	}
+
 	std::size_t allocated_count = 0ULL;
 	Id          constructed;
 
@@ -87,6 +107,9 @@ struct Dummy_Allocator
 	Id          deallocated;
 
 	Id destroyed;
+
+	std::size_t expanded_count = 0ULL;
+	Id          expanded;
 };
 
 using Traits = dsa::Allocator_Traits<Dummy_Allocator>;
@@ -114,6 +137,12 @@ constexpr Dummy_Allocator destroy(Id id) {
 	return allocator;
 }
 
+constexpr Dummy_Allocator expand_in_place(Id id, std::size_t count) {
+	Dummy_Allocator allocator;
+	Traits::expand_in_place(allocator, Dummy_Pointer(id), 0ULL, count);
+	return allocator;
+}
+
 } // namespace custom
 
 TEST_CASE(
@@ -182,6 +211,34 @@ TEST_CASE(
 
 		REQUIRE(allocator.destroyed == id);
 	}
+
+	SECTION("Custom expand_in_place is called in a static context") {
+		constexpr std::size_t count = 4;
+		constexpr Id          id    = Id(2);
+
+		constexpr Dummy_Allocator allocator = expand_in_place(id, count);
+
+		STATIC_REQUIRE(allocator.expanded_count == count);
+		STATIC_REQUIRE(allocator.expanded == id);
+	}
+}
+
+TEST_CASE(
+    "Allocator_Traits considers allocators equal if they can free each other's memory",
+    "[allocator_traits]") {
+	SECTION("Allocators without state are always equal") {
+		using Allocator = dsa::Default_Allocator<Empty_Value>;
+
+		REQUIRE(dsa::Allocator_Traits<Allocator>::equal(Allocator(), Allocator()));
+	}
+
+	SECTION("Allocators with state and no equality operator are only equal to themselves") {
+		custom::Dummy_Allocator allocator;
+		custom::Dummy_Allocator other;
+
+		REQUIRE(custom::Traits::equal(allocator, allocator));
+		REQUIRE_FALSE(custom::Traits::equal(allocator, other));
+	}
 }
 
 } // namespace test
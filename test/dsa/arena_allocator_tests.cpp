@@ -0,0 +1,112 @@
+#include "equals_range_matcher.hpp"
+
+#include <dsa/arena_allocator.hpp>
+#include <dsa/list.hpp>
+#include <dsa/monotonic_buffer.hpp>
+#include <dsa/vector.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace test
+{
+
+TEST_CASE("Monotonic buffers hand out memory by bumping a pointer", "[monotonic_buffer]") {
+	dsa::Monotonic_Buffer<> buffer(64);
+
+	auto *first  = static_cast<std::byte *>(buffer.allocate(3, 1));
+	auto *second = static_cast<std::byte *>(buffer.allocate(8, 8));
+
+	SECTION("Allocations are aligned as requested") {
+		REQUIRE(reinterpret_cast<std::uintptr_t>(second) % 8 == 0);
+		REQUIRE(second >= first + 3);
+	}
+
+	SECTION("The most recent allocation can be released") {
+		buffer.deallocate(second, 8);
+
+		REQUIRE(buffer.allocate(8, 8) == second);
+	}
+
+	SECTION("Earlier allocations are kept until the buffer is reset") {
+		buffer.deallocate(first, 3);
+
+		REQUIRE(buffer.allocate(1, 1) == second + 8);
+	}
+
+	SECTION("The most recent allocation can be expanded in place") {
+		REQUIRE(buffer.expand_in_place(second, 8, 16));
+		REQUIRE_FALSE(buffer.expand_in_place(first, 3, 4));
+		REQUIRE_FALSE(buffer.expand_in_place(second, 16, 128));
+	}
+
+	SECTION("Resetting the buffer reuses its memory") {
+		buffer.reset();
+
+		REQUIRE(buffer.allocate(3, 1) == first);
+		REQUIRE(buffer.capacity() == 64);
+	}
+}
+
+TEST_CASE("Monotonic buffers grow by requesting new chunks", "[monotonic_buffer]") {
+	dsa::Monotonic_Buffer<> buffer;
+	REQUIRE(buffer.capacity() == 0);
+
+	static_cast<void>(buffer.allocate(16, 8));
+	static_cast<void>(buffer.allocate(64, 8));
+	std::size_t const capacity = buffer.capacity();
+	REQUIRE(capacity >= 80);
+
+	SECTION("Resetting merges the chunks so the same work fits in one") {
+		buffer.reset();
+		static_cast<void>(buffer.allocate(16, 8));
+		static_cast<void>(buffer.allocate(64, 8));
+
+		REQUIRE(buffer.capacity() == capacity);
+	}
+}
+
+TEST_CASE("Arena allocators can be used by containers", "[arena_allocator]") {
+	dsa::Monotonic_Buffer<> buffer(1'024);
+
+	SECTION("Vectors grow in place at the top of the buffer") {
+		using Allocator = dsa::Arena_Allocator<int>;
+
+		dsa::Vector<int, Allocator> vector{Allocator(buffer)};
+		vector.append(0);
+		int *const storage = vector.data();
+		vector.append(1);
+		vector.append(2);
+
+		REQUIRE(vector.data() == storage);
+		REQUIRE_THAT(vector, EqualsRange({0, 1, 2}));
+	}
+
+	SECTION("Lists rebind the allocator for their nodes") {
+		using Allocator = dsa::Arena_Allocator<int>;
+
+		dsa::List<int, Allocator> list{{0, 1, 2}, Allocator(buffer)};
+		list.erase(1);
+
+		REQUIRE_THAT(list, EqualsRange({0, 2}));
+	}
+
+	SECTION("Lists drawing from the same buffer can be spliced into one another") {
+		using Allocator = dsa::Arena_Allocator<int>;
+
+		dsa::Monotonic_Buffer<>   other_buffer;
+		dsa::List<int, Allocator> list{{0, 1}, Allocator(buffer)};
+		dsa::List<int, Allocator> other{{2, 3}, Allocator(buffer)};
+		list.splice_back(other);
+
+		REQUIRE(Allocator(buffer) == Allocator(buffer));
+		REQUIRE(Allocator(buffer) != Allocator(other_buffer));
+		REQUIRE_THAT(list, EqualsRange({0, 1, 2, 3}));
+	}
+
+	REQUIRE(buffer.capacity() == 1'024);
+}
+
+} // namespace test
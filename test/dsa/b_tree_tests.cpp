@@ -0,0 +1,318 @@
+#include <dsa/b_tree.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace test
+{
+
+namespace
+{
+
+/// Nodes of the smallest size hold four elements, so a few dozen keys already
+/// split and merge inner nodes
+using Small_B_Tree = dsa::B_Tree<int, int, 0>;
+
+template<typename Tree>
+std::vector<int> keys_of(Tree const &tree) {
+	std::vector<int> keys;
+	for (auto const &[key, value] : tree)
+	{
+		keys.push_back(key);
+	}
+	return keys;
+}
+
+} // namespace
+
+TEST_CASE("B trees associate values to keys", "[b_tree]") {
+	dsa::B_Tree<int, std::string> tree;
+	REQUIRE(tree.empty());
+	REQUIRE(tree.height() == 0);
+	REQUIRE(tree.begin() == tree.end());
+	REQUIRE_FALSE(tree.contains(1));
+
+	SECTION("Inserting a key makes its value findable") {
+		auto const [element, inserted] = tree.insert(1, "one");
+
+		REQUIRE(inserted);
+		REQUIRE(element->first == 1);
+		REQUIRE(element->second == "one");
+		REQUIRE(tree.find(1) == element);
+		REQUIRE(tree.find(2) == tree.end());
+		REQUIRE(tree.size() == 1);
+	}
+
+	SECTION("Inserting a present key keeps its value") {
+		tree.insert(1, "one");
+		auto const [element, inserted] = tree.insert(1, "uno");
+
+		REQUIRE_FALSE(inserted);
+		REQUIRE(element->second == "one");
+		REQUIRE(tree.size() == 1);
+	}
+
+	SECTION("Emplacing constructs the value from the arguments") {
+		REQUIRE(tree.try_emplace(2, 3, 'x').first->second == "xxx");
+		REQUIRE_FALSE(tree.try_emplace(2, 3, 'y').second);
+	}
+
+	SECTION("The subscript operator inserts default values") {
+		tree[1] += "one";
+		tree[1] += "!";
+
+		REQUIRE(tree.size() == 1);
+		REQUIRE(tree[1] == "one!");
+	}
+
+	SECTION("Values can be modified through iterators") {
+		tree.insert(1, "one");
+		tree.find(1)->second = "uno";
+		(*tree.begin()).second += "!";
+
+		REQUIRE(tree.find(1)->second == "uno!");
+	}
+
+	SECTION("Erasing the only key frees the tree") {
+		tree.insert(1, "one");
+
+		REQUIRE(tree.erase(1));
+		REQUIRE_FALSE(tree.erase(1));
+		REQUIRE(tree.empty());
+		REQUIRE(tree.height() == 0);
+	}
+}
+
+TEST_CASE("B trees iterate over their keys in order", "[b_tree]") {
+	Small_B_Tree tree;
+	for (int key : {5, 3, 9, 1, 7, 2, 8, 4, 6, 0})
+	{
+		tree.insert(key, key * 10);
+	}
+
+	REQUIRE(tree.size() == 10);
+	REQUIRE(tree.height() > 1);
+	REQUIRE(keys_of(tree) == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+	for (auto const &[key, value] : tree)
+	{
+		REQUIRE(value == key * 10);
+	}
+}
+
+TEST_CASE("B trees scan ranges of keys", "[b_tree]") {
+	Small_B_Tree tree;
+	for (int key = 0; key < 100; key += 2)
+	{
+		tree.insert(key, key);
+	}
+
+	SECTION("The lower bound of a present key is its element") {
+		REQUIRE(tree.lower_bound(10)->first == 10);
+		REQUIRE(tree.upper_bound(10)->first == 12);
+	}
+
+	SECTION("The bounds of an absent key are the next key") {
+		REQUIRE(tree.lower_bound(11)->first == 12);
+		REQUIRE(tree.upper_bound(11)->first == 12);
+		REQUIRE(tree.lower_bound(-5) == tree.begin());
+	}
+
+	SECTION("Bounds past the last key are the end") {
+		REQUIRE(tree.lower_bound(99) == tree.end());
+		REQUIRE(tree.upper_bound(98) == tree.end());
+	}
+
+	SECTION("Elements between two bounds are scanned in order") {
+		std::vector<int> keys;
+		auto const       last = tree.upper_bound(30);
+		for (auto i = tree.lower_bound(15); i != last; ++i)
+		{
+			keys.push_back(i->first);
+		}
+
+		REQUIRE(keys == std::vector<int>{16, 18, 20, 22, 24, 26, 28, 30});
+	}
+}
+
+TEST_CASE("Elements can be erased from B trees", "[b_tree]") {
+	Small_B_Tree tree;
+	for (int key = 0; key < 200; ++key)
+	{
+		tree.insert(key, key);
+	}
+	std::size_t const height = tree.height();
+
+	SECTION("Erasing an absent key does nothing") {
+		REQUIRE_FALSE(tree.erase(200));
+		REQUIRE(tree.size() == 200);
+	}
+
+	SECTION("Erasing from the front keeps the rest") {
+		for (int key = 0; key < 150; ++key)
+		{
+			REQUIRE(tree.erase(key));
+		}
+
+		REQUIRE(tree.size() == 50);
+		REQUIRE(tree.height() < height);
+		REQUIRE(tree.begin()->first == 150);
+		REQUIRE(tree.contains(199));
+	}
+
+	SECTION("Erasing from the back keeps the rest") {
+		for (int key = 199; key >= 50; --key)
+		{
+			REQUIRE(tree.erase(key));
+		}
+
+		REQUIRE(tree.size() == 50);
+		REQUIRE(keys_of(tree).back() == 49);
+	}
+
+	SECTION("Erasing every key empties the tree") {
+		for (int key = 0; key < 200; key += 2)
+		{
+			REQUIRE(tree.erase(key));
+		}
+		for (int key = 1; key < 200; key += 2)
+		{
+			REQUIRE(tree.erase(key));
+		}
+
+		REQUIRE(tree.empty());
+		REQUIRE(tree.begin() == tree.end());
+		REQUIRE(tree == Small_B_Tree());
+	}
+
+	SECTION("Clear erases all elements from the tree") {
+		tree.clear();
+
+		REQUIRE(tree.empty());
+		REQUIRE(tree.height() == 0);
+		REQUIRE_FALSE(tree.contains(0));
+	}
+}
+
+TEST_CASE("B trees can be copied and moved", "[b_tree]") {
+	dsa::B_Tree<int, std::string, 0> tree;
+	for (int key = 0; key < 50; ++key)
+	{
+		tree.insert(key, std::to_string(key));
+	}
+
+	SECTION("Copies hold the same elements") {
+		auto copy = tree;
+		copy.erase(0);
+
+		REQUIRE(copy != tree);
+		REQUIRE(copy.size() == 49);
+		REQUIRE(tree.find(0)->second == "0");
+		REQUIRE(keys_of(copy).front() == 1);
+
+		copy.insert(0, "0");
+		REQUIRE(copy == tree);
+	}
+
+	SECTION("Copy assignment replaces the elements") {
+		dsa::B_Tree<int, std::string, 0> copy;
+		copy.insert(100, "100");
+		copy = tree;
+
+		REQUIRE(copy == tree);
+		REQUIRE_FALSE(copy.contains(100));
+	}
+
+	SECTION("Moves take the elements") {
+		auto moved = std::move(tree);
+
+		REQUIRE(moved.size() == 50);
+		REQUIRE(moved.find(49)->second == "49");
+	}
+
+	SECTION("B trees can be swapped") {
+		dsa::B_Tree<int, std::string, 0> other;
+		other.insert(100, "100");
+		swap(tree, other);
+
+		REQUIRE(tree.size() == 1);
+		REQUIRE(other.size() == 50);
+	}
+}
+
+TEST_CASE("B trees stay shallow", "[b_tree]") {
+	dsa::B_Tree<int, int> tree;
+	for (int key = 0; key < 100'000; ++key)
+	{
+		tree.insert(key, key);
+	}
+
+	// Every node below the root is at least half full
+	std::size_t const fanout   = tree.node_capacity() / 2;
+	std::size_t       capacity = tree.node_capacity();
+	std::size_t       levels   = 1;
+	while (capacity < tree.size())
+	{
+		capacity *= fanout;
+		++levels;
+	}
+
+	REQUIRE(tree.size() == 100'000);
+	REQUIRE(tree.height() <= levels + 1);
+	REQUIRE(tree.contains(99'999));
+}
+
+TEMPLATE_TEST_CASE(
+    "B trees match std::map under random operations",
+    "[b_tree]",
+    Small_B_Tree,
+    (dsa::B_Tree<int, int>),
+    (dsa::B_Tree<int, int, 4096>)) {
+	// Pages hold over thirty keys, so their nodes are searched with a binary
+	// search rather than a linear one
+	std::mt19937                       generator(42);
+	std::uniform_int_distribution<int> keys(0, 5'000);
+
+	TestType           tree;
+	std::map<int, int> expected;
+	for (int operation = 0; operation < 30'000; ++operation)
+	{
+		int const key = keys(generator);
+		if (operation % 3 == 0)
+		{
+			REQUIRE(tree.erase(key) == (expected.erase(key) == 1));
+		}
+		else
+		{
+			bool const inserted = expected.emplace(key, operation).second;
+			REQUIRE(tree.insert(key, operation).second == inserted);
+		}
+	}
+
+	REQUIRE(tree.size() == expected.size());
+	REQUIRE(std::equal(
+	    tree.begin(),
+	    tree.end(),
+	    expected.begin(),
+	    expected.end(),
+	    [](auto const &element, auto const &other) {
+		    return element.first == other.first && element.second == other.second;
+	    }));
+	for (int key = 0; key <= 5'000; ++key)
+	{
+		auto const element = expected.lower_bound(key);
+		auto const found   = tree.lower_bound(key);
+		REQUIRE((found == tree.end()) == (element == expected.end()));
+		if (element != expected.end())
+		{
+			REQUIRE(found->first == element->first);
+		}
+	}
+}
+
+} // namespace test
@@ -7,6 +7,10 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
 namespace test
 {
 
@@ -196,6 +200,17 @@ TEST_CASE("Elements can be inserted into the binary tree", "[binary_tree]") {
 	}
 }
 
+TEST_CASE("Elements can be constructed in place inside of the binary tree", "[binary_tree]") {
+	Handler_Scope scope;
+
+	Binary_Tree binary_tree{0, -2, 2};
+
+	auto iterator = binary_tree.emplace(1);
+
+	REQUIRE(*iterator == 1);
+	REQUIRE_THAT(binary_tree, EqualsRange({-2, 0, 1, 2}));
+}
+
 TEST_CASE("Elements can be erased from the binary tree", "[binary_tree]") {
 	Handler_Scope scope;
 
@@ -306,4 +321,190 @@ TEST_CASE("Elements can be erased from the binary tree", "[binary_tree]") {
 	}
 }
 
+TEST_CASE("Binary trees keep track of their size", "[binary_tree]") {
+	Handler_Scope scope;
+
+	Binary_Tree binary_tree{0, -2, 2, -1, 1};
+	REQUIRE(binary_tree.size() == 5);
+
+	binary_tree.emplace(3);
+	REQUIRE(binary_tree.size() == 6);
+
+	binary_tree.erase(0);
+	binary_tree.erase(-2);
+	REQUIRE(binary_tree.size() == 4);
+
+	Binary_Tree copy(binary_tree);
+	REQUIRE(copy.size() == 4);
+
+	Binary_Tree moved(std::move(copy));
+	REQUIRE(moved.size() == 4);
+	REQUIRE(copy.size() == 0);
+
+	binary_tree.clear();
+	REQUIRE(binary_tree.size() == 0);
+}
+
+TEST_CASE("Degenerate binary trees can be copied, compared and cleared", "[binary_tree]") {
+	// Sorted insertions build a list, which these operations walk without
+	// recursing
+	constexpr int           count = 10'000;
+	dsa::Binary_Tree<Value> binary_tree;
+	for (int value = 0; value < count; ++value)
+	{
+		binary_tree.insert(value);
+	}
+
+	dsa::Binary_Tree<Value> copy(binary_tree);
+	REQUIRE(copy.size() == count);
+	REQUIRE(copy == binary_tree);
+
+	copy.erase(count - 1);
+	REQUIRE(copy != binary_tree);
+
+	copy.clear();
+	REQUIRE(copy.empty());
+}
+
+TEST_CASE("Binary trees answer order statistics", "[binary_tree]") {
+	Handler_Scope scope;
+
+	Binary_Tree binary_tree{4, 1, 6, 0, 3, 5, 8, 2, 7};
+
+	SECTION("Select finds the element at a position in sorted order") {
+		for (std::size_t index = 0; index < binary_tree.size(); ++index)
+		{
+			REQUIRE(*binary_tree.select(index) == static_cast<Value>(index));
+		}
+		REQUIRE(binary_tree.select(binary_tree.size()) == binary_tree.end());
+	}
+
+	SECTION("Rank counts the elements less than a value") {
+		REQUIRE(binary_tree.rank(-1) == 0);
+		REQUIRE(binary_tree.rank(0) == 0);
+		REQUIRE(binary_tree.rank(4) == 4);
+		REQUIRE(binary_tree.rank(9) == 9);
+	}
+
+	SECTION("Count range counts the elements in a half open range") {
+		REQUIRE(binary_tree.count_range(2, 6) == 4);
+		REQUIRE(binary_tree.count_range(-5, 50) == 9);
+		REQUIRE(binary_tree.count_range(6, 2) == 0);
+		REQUIRE(binary_tree.count_range(3, 3) == 0);
+	}
+
+	SECTION("Order statistics follow erasures") {
+		binary_tree.erase(4);
+		binary_tree.erase(0);
+
+		REQUIRE(*binary_tree.select(0) == 1);
+		REQUIRE(*binary_tree.select(3) == 5);
+		REQUIRE(binary_tree.rank(6) == 4);
+		REQUIRE(binary_tree.count_range(0, 5) == 3);
+	}
+
+	SECTION("Copies keep the order statistics") {
+		Binary_Tree const copy(binary_tree);
+
+		REQUIRE(*copy.select(5) == 5);
+		REQUIRE(copy.rank(7) == 7);
+	}
+}
+
+TEST_CASE("Binary trees find the bounds of a value", "[binary_tree]") {
+	Handler_Scope scope;
+
+	Binary_Tree binary_tree{4, 2, 6, 2, 8};
+
+	SECTION("The lower bound is the first element not less than the value") {
+		REQUIRE(*binary_tree.lower_bound(2) == 2);
+		REQUIRE(*binary_tree.lower_bound(3) == 4);
+		REQUIRE(binary_tree.lower_bound(0) == binary_tree.begin());
+		REQUIRE(binary_tree.lower_bound(9) == binary_tree.end());
+	}
+
+	SECTION("The upper bound is the first element greater than the value") {
+		REQUIRE(*binary_tree.upper_bound(2) == 4);
+		REQUIRE(*binary_tree.upper_bound(5) == 6);
+		REQUIRE(binary_tree.upper_bound(8) == binary_tree.end());
+	}
+
+	SECTION("Equal elements lie between the bounds") {
+		std::size_t count = 0;
+		auto const  last  = binary_tree.upper_bound(2);
+		for (auto element = binary_tree.lower_bound(2); element != last; ++element)
+		{
+			REQUIRE(*element == 2);
+			++count;
+		}
+		REQUIRE(count == 2);
+	}
+}
+
+TEST_CASE("Binary trees are traversed in order", "[binary_tree]") {
+	Handler_Scope scope;
+
+	Binary_Tree binary_tree{4, 2, 6, 1, 3, 5, 7};
+
+	SECTION("The first element follows insertions and erasures") {
+		binary_tree.insert(0);
+		REQUIRE(*binary_tree.begin() == 0);
+
+		binary_tree.erase(0);
+		binary_tree.erase(1);
+		REQUIRE(*binary_tree.begin() == 2);
+
+		binary_tree.erase(2);
+		REQUIRE(*binary_tree.begin() == 3);
+	}
+
+	SECTION("Every element is visited in sorted order") {
+		std::vector<Value> visited;
+		binary_tree.for_each_in_order([&visited](auto const &value) { visited.push_back(value); });
+
+		REQUIRE(visited == std::vector<Value>{1, 2, 3, 4, 5, 6, 7});
+	}
+
+	SECTION("Elements of constant trees are visited in sorted order") {
+		Binary_Tree const  copy(binary_tree);
+		std::vector<Value> visited;
+		copy.for_each_in_order([&visited](Value const &value) { visited.push_back(value); });
+
+		REQUIRE(visited == std::vector<Value>{1, 2, 3, 4, 5, 6, 7});
+	}
+
+	SECTION("The callback can read the tree while it is visited") {
+		std::vector<Value> visited;
+		binary_tree.for_each_in_order([&](Value const &value) {
+			visited.push_back(*binary_tree.lower_bound(value));
+			REQUIRE(std::distance(binary_tree.begin(), binary_tree.end()) == 7);
+		});
+
+		REQUIRE(visited == std::vector<Value>{1, 2, 3, 4, 5, 6, 7});
+	}
+
+	SECTION("Paths deeper than the visiting stack are visited in sorted order") {
+		// Alternating between both ends builds a zig zag path as deep as the
+		// tree, so both children of the path are walked past the stack
+		Binary_Tree        deep;
+		std::vector<Value> expected;
+		for (Value i = 0; i < 300; ++i)
+		{
+			deep.insert(i % 2 == 0 ? i : 10'000 - i);
+		}
+		deep.for_each_in_order([&expected](Value const &value) { expected.push_back(value); });
+
+		REQUIRE(expected.size() == 300);
+		REQUIRE(std::equal(deep.begin(), deep.end(), expected.begin(), expected.end()));
+	}
+
+	SECTION("Empty trees visit no elements") {
+		binary_tree.clear();
+		std::size_t visited = 0;
+		binary_tree.for_each_in_order([&visited](Value const &) { ++visited; });
+
+		REQUIRE(visited == 0);
+	}
+}
+
 } // namespace test
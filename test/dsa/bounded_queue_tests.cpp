@@ -0,0 +1,121 @@
+#include <dsa/bounded_queue.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace test
+{
+
+TEST_CASE("Bounded queues hand out elements in the order they were pushed", "[bounded_queue]") {
+	dsa::Bounded_Queue<int> queue(4);
+
+	SECTION("Empty queues have nothing to pop") {
+		REQUIRE_FALSE(queue.try_pop().has_value());
+	}
+
+	SECTION("Elements are popped first in first out") {
+		REQUIRE(queue.try_push(1));
+		REQUIRE(queue.try_push(2));
+
+		REQUIRE(queue.try_pop() == 1);
+		REQUIRE(queue.try_pop() == 2);
+		REQUIRE_FALSE(queue.try_pop().has_value());
+	}
+
+	SECTION("Full queues refuse elements") {
+		for (int value = 0; value < 4; ++value)
+		{
+			REQUIRE(queue.try_push(value));
+		}
+		REQUIRE_FALSE(queue.try_push(4));
+
+		REQUIRE(queue.try_pop() == 0);
+		REQUIRE(queue.try_push(4));
+	}
+
+	SECTION("Slots are reused around the ring") {
+		for (int value = 0; value < 100; ++value)
+		{
+			REQUIRE(queue.try_push(value));
+			REQUIRE(queue.try_pop() == value);
+		}
+	}
+}
+
+TEST_CASE("Bounded queues round their capacity up to a power of two", "[bounded_queue]") {
+	REQUIRE(dsa::Bounded_Queue<int>(0).capacity() == 2);
+	REQUIRE(dsa::Bounded_Queue<int>(5).capacity() == 8);
+	REQUIRE(dsa::Bounded_Queue<int>(16).capacity() == 16);
+}
+
+TEST_CASE("Bounded queues own the elements they hold", "[bounded_queue]") {
+	auto const shared = std::make_shared<int>(0);
+	{
+		dsa::Bounded_Queue<std::shared_ptr<int>> queue(2);
+		queue.try_push(shared);
+		queue.try_push(shared);
+
+		std::shared_ptr<int> refused = shared;
+		REQUIRE_FALSE(queue.try_push(std::move(refused)));
+		REQUIRE(refused == shared);
+		REQUIRE(shared.use_count() == 4);
+	}
+
+	REQUIRE(shared.use_count() == 1);
+}
+
+TEST_CASE("Bounded queues are shared by producer and consumer threads", "[bounded_queue]") {
+	std::size_t const     thread_count = GENERATE(1ULL, 4ULL);
+	constexpr std::size_t per_thread   = 10'000;
+	std::size_t const     total        = thread_count * per_thread;
+
+	dsa::Bounded_Queue<std::size_t> queue(64);
+	std::vector<std::atomic<int>>   popped(total);
+	std::atomic<std::size_t>        popped_count = 0;
+
+	std::vector<std::thread> threads;
+	for (std::size_t thread = 0; thread < thread_count; ++thread)
+	{
+		threads.emplace_back([&, thread] {
+			for (std::size_t i = 0; i < per_thread; ++i)
+			{
+				while (!queue.try_push(thread * per_thread + i))
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+		threads.emplace_back([&] {
+			while (popped_count.load() < total)
+			{
+				if (auto const value = queue.try_pop())
+				{
+					popped[*value]++;
+					popped_count++;
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+	for (std::thread &thread : threads)
+	{
+		thread.join();
+	}
+
+	// Every value was popped exactly once
+	for (std::atomic<int> const &count : popped)
+	{
+		REQUIRE(count == 1);
+	}
+}
+
+} // namespace test
@@ -1,6 +1,7 @@
 #include "allocation_verifier.hpp"
 #include "empty_value.hpp"
 #include "equals_range_matcher.hpp"
+#include "expandable_allocator.hpp"
 #include "memory_monitor_handler_scope.hpp"
 
 #include <dsa/dynamic_array.hpp>
@@ -192,6 +193,17 @@ TEST_CASE("Dynamic arrays can be resized at runtime", "[dynamic_array]") {
 
 		REQUIRE_THAT(array, EqualsRange(expected));
 	}
+
+	SECTION("Increasing array size expands in place when the allocator supports it") {
+		dsa::Dynamic_Array<int, Expandable_Allocator<int>> array{1, 2};
+
+		int *const storage = array.data();
+		array.resize(4, 3);
+
+		REQUIRE(array.data() == storage);
+		REQUIRE(array.allocator().expansions() == 1);
+		REQUIRE_THAT(array, EqualsRange({1, 2, 3, 3}));
+	}
 }
 
 } // namespace test
@@ -0,0 +1,59 @@
+#ifndef TEST_DSA_STATIC_EXPANDABLE_ALLOCATOR_HPP
+#define TEST_DSA_STATIC_EXPANDABLE_ALLOCATOR_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+
+namespace test
+{
+
+/// @brief Reserves a fixed number of elements for every allocation so that
+/// the allocation can later be expanded in place up to that limit
+template<typename Value_t>
+class Expandable_Allocator
+{
+ public:
+	template<typename T>
+	using rebind = Expandable_Allocator<T>;
+
+	using Value = Value_t;
+
+	static constexpr std::size_t reserved = 64;
+
+	Expandable_Allocator() = default;
+
+	template<typename T>
+	explicit Expandable_Allocator(Expandable_Allocator<T> const & /* allocator */) {
+	}
+
+	Value *allocate(std::size_t count) {
+		assert(count <= reserved && "The allocator cannot provide more than it reserves");
+		return std::allocator<Value>().allocate(reserved);
+	}
+
+	void deallocate(Value *pointer, std::size_t /* count */) {
+		std::allocator<Value>().deallocate(pointer, reserved);
+	}
+
+	bool expand_in_place(Value * /* pointer */, std::size_t /* count */, std::size_t new_count) {
+		if (new_count > reserved)
+		{
+			return false;
+		}
+
+		m_expansions++;
+		return true;
+	}
+
+	[[nodiscard]] std::size_t expansions() const {
+		return m_expansions;
+	}
+
+ private:
+	std::size_t m_expansions = 0;
+};
+
+} // namespace test
+
+#endif
@@ -0,0 +1,68 @@
+#include <dsa/dynamic_array.hpp>
+#include <dsa/eytzinger_array.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
+namespace test
+{
+
+TEST_CASE("Eytzinger arrays find the first key not less than a value", "[eytzinger_array]") {
+	SECTION("Searching an empty array finds nothing") {
+		dsa::Dynamic_Array<int>   sorted;
+		dsa::Eytzinger_Array<int> array(sorted);
+
+		REQUIRE(array.empty());
+		REQUIRE(array.lower_bound(0) == nullptr);
+		REQUIRE_FALSE(array.contains(0));
+	}
+
+	SECTION("Searches match std::lower_bound on every size and value") {
+		for (std::size_t size = 1; size < 70; ++size)
+		{
+			dsa::Dynamic_Array<int> sorted(size);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				sorted[i] = static_cast<int>(i / 2 * 3);
+			}
+			dsa::Eytzinger_Array<int> array(sorted);
+			REQUIRE(array.size() == size);
+
+			for (int value = -1; value <= sorted[size - 1] + 1; ++value)
+			{
+				int const *const expected =
+				    std::lower_bound(sorted.begin(), sorted.end(), value);
+				int const *const key = array.lower_bound(value);
+
+				if (expected == sorted.end())
+				{
+					REQUIRE(key == nullptr);
+				}
+				else
+				{
+					REQUIRE(key != nullptr);
+					REQUIRE(*key == *expected);
+				}
+				REQUIRE(array.contains(value) == (value % 3 == 0));
+			}
+		}
+	}
+
+	SECTION("Searches support a comparator argument") {
+		dsa::Dynamic_Array        sorted{53, 45, 33, 31, 21};
+		dsa::Eytzinger_Array<int> array(sorted);
+
+		int const *key = array.lower_bound(40, std::greater{});
+
+		REQUIRE(key != nullptr);
+		REQUIRE(*key == 33);
+		REQUIRE(array.find(33, std::greater{}) == key);
+		REQUIRE(array.find(40, std::greater{}) == nullptr);
+		REQUIRE(array.contains(21, std::greater{}));
+	}
+}
+
+} // namespace test
@@ -0,0 +1,291 @@
+#include "allocation_verifier.hpp"
+#include "memory_monitor_handler_scope.hpp"
+
+#include <dsa/flat_hash_map.hpp>
+#include <dsa/memory_monitor.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace test
+{
+
+using Handler_Scope = Memory_Monitor_Handler_Scope<Allocation_Verifier>;
+
+namespace
+{
+
+/// The values of the monitored maps, which let the memory monitor find a way to
+/// print their elements
+enum class Score : int
+{
+};
+
+std::ostream &operator<<(std::ostream &stream, std::pair<int, Score> const &element) {
+	return stream << element.first << ": " << static_cast<int>(element.second);
+}
+
+using Monitored_Map = dsa::Flat_Hash_Map<
+    int,
+    Score,
+    std::hash<int>,
+    std::equal_to<int>,
+    dsa::Memory_Monitor<std::pair<int, Score>, Allocation_Verifier>>;
+
+/// Sends every key to the same home group, so that lookups have to follow
+/// the overflow counts through full groups
+struct Colliding_Hash
+{
+	std::size_t operator()(int /* key */) const {
+		return 0;
+	}
+};
+
+/// Hashes strings and string views alike, so that lookups with a view do not
+/// construct a string
+struct String_Hash
+{
+	using is_transparent = void;
+
+	std::size_t operator()(std::string_view key) const {
+		return std::hash<std::string_view>{}(key);
+	}
+};
+
+} // namespace
+
+TEST_CASE("Flat hash maps associate values to keys", "[flat_hash_map]") {
+	dsa::Flat_Hash_Map<int, std::string> map;
+	REQUIRE(map.empty());
+	REQUIRE(map.capacity() == 0);
+	REQUIRE_FALSE(map.contains(1));
+
+	SECTION("Inserting a key makes its value findable") {
+		auto const [element, inserted] = map.insert(1, "one");
+
+		REQUIRE(inserted);
+		REQUIRE(element->first == 1);
+		REQUIRE(element->second == "one");
+		REQUIRE(map.find(1) == element);
+		REQUIRE(map.find(2) == map.end());
+		REQUIRE(map.size() == 1);
+	}
+
+	SECTION("Inserting a present key keeps its value") {
+		map.insert(1, "one");
+		auto const [element, inserted] = map.insert(1, "uno");
+
+		REQUIRE_FALSE(inserted);
+		REQUIRE(element->second == "one");
+	}
+
+	SECTION("Emplacing a present key constructs nothing") {
+		map.insert(1, "one");
+		auto const [element, inserted] = map.try_emplace(1, 3, 'x');
+
+		REQUIRE_FALSE(inserted);
+		REQUIRE(map.try_emplace(2, 3, 'x').first->second == "xxx");
+	}
+
+	SECTION("The subscript operator inserts default values") {
+		map[1] += "one";
+		map[1] += "!";
+
+		REQUIRE(map.size() == 1);
+		REQUIRE(map[1] == "one!");
+	}
+
+	SECTION("Erasing a key removes it") {
+		map.insert(1, "one");
+		map.insert(2, "two");
+
+		REQUIRE(map.erase(1));
+		REQUIRE_FALSE(map.erase(1));
+		REQUIRE_FALSE(map.contains(1));
+		REQUIRE(map.find(2)->second == "two");
+		REQUIRE(map.size() == 1);
+	}
+
+	SECTION("Clearing a map keeps its slots") {
+		map.insert(1, "one");
+		std::size_t const capacity = map.capacity();
+
+		map.clear();
+
+		REQUIRE(map.empty());
+		REQUIRE_FALSE(map.contains(1));
+		REQUIRE(map.capacity() == capacity);
+	}
+}
+
+TEST_CASE("Flat hash maps grow to keep free slots", "[flat_hash_map]") {
+	Handler_Scope scope;
+
+	SECTION("Reserving makes room without rehashing later") {
+		Monitored_Map     map(100);
+		std::size_t const capacity = map.capacity();
+		REQUIRE(capacity * 7 / 8 >= 100);
+
+		for (int key = 0; key < 100; ++key)
+		{
+			map.insert(key, Score{key});
+		}
+
+		REQUIRE(map.capacity() == capacity);
+	}
+
+	SECTION("Every key is kept while growing") {
+		Monitored_Map map;
+		for (int key = 0; key < 1'000; ++key)
+		{
+			map.insert(key * 1'024, Score{key});
+		}
+
+		REQUIRE(map.size() == 1'000);
+		for (int key = 0; key < 1'000; ++key)
+		{
+			REQUIRE(map.find(key * 1'024)->second == Score{key});
+			REQUIRE_FALSE(map.contains(key * 1'024 + 1));
+		}
+	}
+}
+
+TEST_CASE("Flat hash maps find keys past full groups", "[flat_hash_map]") {
+	dsa::Flat_Hash_Map<int, int, Colliding_Hash> map;
+	for (int key = 0; key < 100; ++key)
+	{
+		map.insert(key, key);
+	}
+
+	SECTION("Every key is reachable from its home group") {
+		for (int key = 0; key < 100; ++key)
+		{
+			REQUIRE(map.find(key)->second == key);
+		}
+		REQUIRE_FALSE(map.contains(100));
+	}
+
+	SECTION("Erasing keys of earlier groups keeps later ones reachable") {
+		for (int key = 0; key < 50; ++key)
+		{
+			REQUIRE(map.erase(key));
+		}
+
+		for (int key = 0; key < 100; ++key)
+		{
+			REQUIRE(map.contains(key) == (key >= 50));
+		}
+	}
+
+	SECTION("Freed slots are reused without growing") {
+		std::size_t const capacity = map.capacity();
+		for (int round = 0; round < 10; ++round)
+		{
+			for (int key = 0; key < 100; ++key)
+			{
+				map.erase(key);
+			}
+			for (int key = 0; key < 100; ++key)
+			{
+				map.insert(key, round);
+			}
+		}
+
+		REQUIRE(map.capacity() == capacity);
+		REQUIRE(map.find(99)->second == 9);
+	}
+}
+
+TEST_CASE("Flat hash maps look up keys of other types", "[flat_hash_map]") {
+	dsa::Flat_Hash_Map<std::string, int, String_Hash, std::equal_to<>> map;
+	map.insert("one", 1);
+	map.insert("two", 2);
+
+	std::string_view const one = "one";
+
+	REQUIRE(map.find(one)->second == 1);
+	REQUIRE(map.contains("two"));
+	REQUIRE_FALSE(map.contains(std::string_view("three")));
+	REQUIRE(map.erase(one));
+	REQUIRE_FALSE(map.contains(one));
+}
+
+TEST_CASE("Flat hash maps can be copied and moved", "[flat_hash_map]") {
+	Handler_Scope scope;
+
+	Monitored_Map map;
+	map.insert(1, Score{1});
+	map.insert(2, Score{2});
+
+	SECTION("Copies hold the same elements") {
+		Monitored_Map copy(map);
+		copy.insert(3, Score{3});
+
+		REQUIRE(copy.find(1)->second == Score{1});
+		REQUIRE(copy.find(2)->second == Score{2});
+		REQUIRE_FALSE(map.contains(3));
+	}
+
+	SECTION("Copy assignment replaces the elements") {
+		Monitored_Map copy;
+		copy.insert(3, Score{3});
+		copy = map;
+
+		REQUIRE(copy.size() == 2);
+		REQUIRE_FALSE(copy.contains(3));
+	}
+
+	SECTION("Moves take the elements") {
+		Monitored_Map moved(std::move(map));
+
+		REQUIRE(moved.size() == 2);
+		REQUIRE(moved.find(1)->second == Score{1});
+	}
+}
+
+TEST_CASE("Flat hash maps match std::unordered_map under random operations", "[flat_hash_map]") {
+	std::mt19937                       generator(42);
+	std::uniform_int_distribution<int> keys(0, 500);
+
+	dsa::Flat_Hash_Map<int, int> map;
+	std::unordered_map<int, int> expected;
+
+	for (int operation = 0; operation < 10'000; ++operation)
+	{
+		int const key = keys(generator);
+		if (operation % 3 == 0)
+		{
+			REQUIRE(map.erase(key) == (expected.erase(key) == 1));
+		}
+		else
+		{
+			bool const inserted = expected.emplace(key, operation).second;
+			REQUIRE(map.insert(key, operation).second == inserted);
+		}
+	}
+
+	REQUIRE(map.size() == expected.size());
+	for (auto const &[key, value] : expected)
+	{
+		auto const element = map.find(key);
+		REQUIRE(element != map.end());
+		REQUIRE(element->second == value);
+	}
+
+	std::size_t count = 0;
+	for (auto const &[key, value] : map)
+	{
+		REQUIRE(expected.at(key) == value);
+		++count;
+	}
+	REQUIRE(count == expected.size());
+}
+
+} // namespace test
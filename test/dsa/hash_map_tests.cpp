@@ -0,0 +1,96 @@
+#include <dsa/hash_map.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+namespace test
+{
+
+TEST_CASE("Hash maps associate values to keys", "[hash_map]") {
+	dsa::Hash_Map<int, std::string> map;
+
+	SECTION("Inserting a key makes its value findable") {
+		auto const [element, inserted] = map.insert(1, "one");
+
+		REQUIRE(inserted);
+		REQUIRE(element->first == 1);
+		REQUIRE(element->second == "one");
+		REQUIRE(map.find(1)->second == "one");
+		REQUIRE(map.find(2) == map.end());
+	}
+
+	SECTION("Inserting a present key keeps its value") {
+		map.insert(1, "one");
+		auto const [element, inserted] = map.insert(1, "uno");
+
+		REQUIRE_FALSE(inserted);
+		REQUIRE(element->second == "one");
+	}
+
+	SECTION("Emplacing a present key constructs nothing") {
+		map.insert(1, "one");
+		auto const [element, inserted] = map.try_emplace(1, 3, 'x');
+
+		REQUIRE_FALSE(inserted);
+		REQUIRE(map.try_emplace(2, 3, 'x').first->second == "xxx");
+	}
+
+	SECTION("The subscript operator inserts default values") {
+		map[1] += "one";
+		map[1] += "!";
+
+		REQUIRE(map.size() == 1);
+		REQUIRE(map[1] == "one!");
+	}
+
+	SECTION("Values can be modified through iterators") {
+		map.insert(1, "one");
+		map.find(1)->second = "uno";
+
+		REQUIRE(map[1] == "uno");
+	}
+}
+
+TEST_CASE("Hash maps match std::unordered_map under random operations", "[hash_map]") {
+	std::mt19937                       generator(42);
+	std::uniform_int_distribution<int> keys(0, 500);
+
+	dsa::Hash_Map<int, int>      map;
+	std::unordered_map<int, int> expected;
+
+	for (int operation = 0; operation < 10'000; ++operation)
+	{
+		int const key = keys(generator);
+		if (operation % 3 == 0)
+		{
+			REQUIRE(map.erase(key) == (expected.erase(key) == 1));
+		}
+		else
+		{
+			bool const inserted = expected.emplace(key, operation).second;
+			REQUIRE(map.insert(key, operation).second == inserted);
+		}
+	}
+
+	REQUIRE(map.size() == expected.size());
+	for (auto const &[key, value] : expected)
+	{
+		auto const element = map.find(key);
+		REQUIRE(element != map.end());
+		REQUIRE(element->second == value);
+	}
+
+	std::size_t count = 0;
+	for (auto const &[key, value] : map)
+	{
+		REQUIRE(expected.at(key) == value);
+		++count;
+	}
+	REQUIRE(count == expected.size());
+}
+
+} // namespace test
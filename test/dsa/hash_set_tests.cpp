@@ -0,0 +1,205 @@
+#include "allocation_verifier.hpp"
+#include "memory_monitor_handler_scope.hpp"
+
+#include <dsa/hash_set.hpp>
+#include <dsa/memory_monitor.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <set>
+
+namespace test
+{
+
+using Value         = int;
+using Allocator     = dsa::Memory_Monitor<Value, Allocation_Verifier>;
+using Handler_Scope = Memory_Monitor_Handler_Scope<Allocation_Verifier>;
+using Hash_Set      = dsa::Hash_Set<Value, std::hash<Value>, std::equal_to<Value>, Allocator>;
+
+namespace
+{
+
+/// Sends every key to the same home slot, so that every operation has to walk
+/// and shift a single run of elements
+struct Colliding_Hash
+{
+	std::size_t operator()(int /* key */) const {
+		return 0;
+	}
+};
+
+} // namespace
+
+TEST_CASE("Hash sets hold unique keys", "[hash_set]") {
+	Handler_Scope scope;
+
+	Hash_Set set;
+	REQUIRE(set.empty());
+	REQUIRE(set.capacity() == 0);
+	REQUIRE_FALSE(set.contains(1));
+
+	SECTION("Inserting a key makes it findable") {
+		auto const [element, inserted] = set.insert(1);
+
+		REQUIRE(inserted);
+		REQUIRE(*element == 1);
+		REQUIRE(set.find(1) == element);
+		REQUIRE(set.contains(1));
+		REQUIRE(set.size() == 1);
+	}
+
+	SECTION("Inserting a present key does nothing") {
+		set.insert(1);
+		auto const [element, inserted] = set.insert(1);
+
+		REQUIRE_FALSE(inserted);
+		REQUIRE(*element == 1);
+		REQUIRE(set.size() == 1);
+	}
+
+	SECTION("Erasing a key removes it") {
+		set.insert(1);
+		set.insert(2);
+
+		REQUIRE(set.erase(1));
+		REQUIRE_FALSE(set.erase(1));
+		REQUIRE_FALSE(set.contains(1));
+		REQUIRE(set.contains(2));
+		REQUIRE(set.size() == 1);
+	}
+
+	SECTION("Clearing a set keeps its slots") {
+		set.insert(1);
+		std::size_t const capacity = set.capacity();
+
+		set.clear();
+
+		REQUIRE(set.empty());
+		REQUIRE_FALSE(set.contains(1));
+		REQUIRE(set.capacity() == capacity);
+	}
+}
+
+TEST_CASE("Hash sets grow to keep free slots", "[hash_set]") {
+	Handler_Scope scope;
+
+	SECTION("Reserving makes room without rehashing later") {
+		Hash_Set set(100);
+		std::size_t const capacity = set.capacity();
+		REQUIRE(capacity * 7 / 8 >= 100);
+
+		for (int key = 0; key < 100; ++key)
+		{
+			set.insert(key);
+		}
+
+		REQUIRE(set.capacity() == capacity);
+	}
+
+	SECTION("Every key is kept while growing") {
+		Hash_Set set;
+		for (int key = 0; key < 1'000; ++key)
+		{
+			set.insert(key * 1'024);
+		}
+
+		REQUIRE(set.size() == 1'000);
+		REQUIRE(set.capacity() * 7 / 8 >= 1'000);
+		for (int key = 0; key < 1'000; ++key)
+		{
+			REQUIRE(set.contains(key * 1'024));
+			REQUIRE_FALSE(set.contains(key * 1'024 + 1));
+		}
+	}
+}
+
+TEST_CASE("Hash sets iterate over every key once", "[hash_set]") {
+	Handler_Scope scope;
+
+	Hash_Set set;
+	for (int key = 0; key < 50; ++key)
+	{
+		set.insert(key);
+	}
+	set.erase(10);
+
+	std::set<int> keys(set.begin(), set.end());
+
+	REQUIRE(keys.size() == 49);
+	REQUIRE(*keys.begin() == 0);
+	REQUIRE(*keys.rbegin() == 49);
+	REQUIRE_FALSE(keys.contains(10));
+}
+
+TEST_CASE("Hash sets can be copied and moved", "[hash_set]") {
+	Handler_Scope scope;
+
+	Hash_Set set;
+	set.insert(1);
+	set.insert(2);
+
+	SECTION("Copies hold the same keys") {
+		Hash_Set copy(set);
+		copy.insert(3);
+
+		REQUIRE(copy.contains(1));
+		REQUIRE(copy.contains(2));
+		REQUIRE_FALSE(set.contains(3));
+	}
+
+	SECTION("Copy assignment replaces the keys") {
+		Hash_Set copy;
+		copy.insert(3);
+		copy = set;
+
+		REQUIRE(copy.size() == 2);
+		REQUIRE_FALSE(copy.contains(3));
+	}
+
+	SECTION("Moves take the keys") {
+		Hash_Set moved(std::move(set));
+
+		REQUIRE(moved.contains(1));
+		REQUIRE(moved.contains(2));
+	}
+
+	SECTION("Moved from sets can be reused") {
+		Hash_Set moved(std::move(set));
+		set.insert(3);
+
+		REQUIRE(set.size() == 1);
+		REQUIRE(set.contains(3));
+	}
+}
+
+TEST_CASE("Hash sets handle keys sharing a home slot", "[hash_set]") {
+	dsa::Hash_Set<int, Colliding_Hash> set;
+	for (int key = 0; key < 20; ++key)
+	{
+		set.insert(key);
+	}
+
+	SECTION("Every key is found") {
+		for (int key = 0; key < 20; ++key)
+		{
+			REQUIRE(set.contains(key));
+		}
+		REQUIRE_FALSE(set.contains(20));
+	}
+
+	SECTION("Erasing shifts the rest of the run back") {
+		for (int key = 0; key < 20; key += 2)
+		{
+			REQUIRE(set.erase(key));
+		}
+
+		for (int key = 0; key < 20; ++key)
+		{
+			REQUIRE(set.contains(key) == (key % 2 == 1));
+		}
+	}
+}
+
+} // namespace test
@@ -7,7 +7,11 @@
 #include <dsa/heap.hpp>
 #include <dsa/memory_monitor.hpp>
 
+#include <cstddef>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <catch2/catch_all.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -19,9 +23,25 @@ namespace test
 struct IsHeap : Catch::Matchers::MatcherGenericBase
 {
 	bool match(auto const &heap) const {
-		using Comparator = typename std::decay_t<decltype(heap)>::Comparator;
-
-		return dsa::is_heap(std::begin(heap.storage()), std::end(heap.storage()), Comparator{});
+		using Heap_Type  = std::decay_t<decltype(heap)>;
+		using Comparator = typename Heap_Type::Comparator;
+
+		auto const &storage = heap.storage();
+		if constexpr (Heap_Type::arity() == 2)
+		{
+			return dsa::is_heap(std::begin(storage), std::end(storage), Comparator{});
+		}
+		else
+		{
+			for (std::size_t child = 1; child < storage.size(); ++child)
+			{
+				if (Comparator{}(storage[child], storage[(child - 1) / Heap_Type::arity()]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
 	}
 
 	std::string describe() const override {
@@ -210,4 +230,129 @@ TEST_CASE("Heaps can have their elements popped", "[heap]") {
 	}
 }
 
+TEST_CASE("Heaps can give each element more than two children", "[heap]") {
+	Handler_Scope scope;
+
+	using Quaternary_Heap = dsa::Heap<Value, decltype(std::less{}), Allocator, 4>;
+	using Octonary_Heap   = dsa::Heap<Value, decltype(std::less{}), Allocator, 8>;
+
+	SECTION("Elements are popped in order from a four-ary heap") {
+		Quaternary_Heap heap{9, 4, 7, 1, 8, 2, 6, 3, 5, 0};
+		REQUIRE_THAT(heap, IsHeap());
+
+		for (int expected = 0; expected < 10; ++expected)
+		{
+			REQUIRE(heap.top() == expected);
+			heap.pop();
+			REQUIRE_THAT(heap, IsHeap());
+		}
+		REQUIRE(heap.empty());
+	}
+
+	SECTION("Elements are popped in order from an eight-ary heap") {
+		Octonary_Heap heap;
+		for (int value = 39; value >= 0; --value)
+		{
+			heap.push(value * 7 % 40);
+		}
+		REQUIRE_THAT(heap, IsHeap());
+
+		for (int expected = 0; expected < 40; ++expected)
+		{
+			REQUIRE(heap.top() == expected);
+			heap.pop();
+		}
+		REQUIRE(heap.empty());
+	}
+}
+
+TEST_CASE("Only indexed heaps hand out handles", "[heap]") {
+	using Indexed_Heap = dsa::Indexed_Heap<Value, decltype(std::less{}), Allocator>;
+
+	STATIC_REQUIRE(std::is_void_v<decltype(std::declval<Heap &>().push(0))>);
+	STATIC_REQUIRE(
+	    std::is_same_v<decltype(std::declval<Indexed_Heap &>().push(0)), Indexed_Heap::Handle>);
+}
+
+TEST_CASE("Heap elements can be updated and erased through their handles", "[heap]") {
+	Handler_Scope scope;
+
+	using Indexed_Heap    = dsa::Indexed_Heap<Value, decltype(std::less{}), Allocator>;
+	using Quaternary_Heap = dsa::Indexed_Heap<Value, decltype(std::less{}), Allocator, 4>;
+
+	Indexed_Heap                      heap;
+	std::vector<Indexed_Heap::Handle> handles;
+	for (int value = 0; value < 10; ++value)
+	{
+		handles.push_back(heap.push(value * 10));
+	}
+
+	SECTION("Handles refer to the element they were given for") {
+		for (std::size_t i = 0; i < handles.size(); ++i)
+		{
+			REQUIRE(heap.value(handles[i]) == static_cast<int>(i) * 10);
+		}
+	}
+
+	SECTION("Decreasing a value moves it towards the top") {
+		heap.update(handles[7], -1);
+
+		REQUIRE(heap.top() == -1);
+		REQUIRE(heap.value(handles[7]) == -1);
+		REQUIRE(heap.value(handles[0]) == 0);
+		REQUIRE_THAT(heap, IsHeap());
+	}
+
+	SECTION("Increasing a value moves it away from the top") {
+		heap.update(handles[0], 95);
+
+		REQUIRE(heap.top() == 10);
+		REQUIRE(heap.value(handles[0]) == 95);
+		REQUIRE_THAT(heap, IsHeap());
+	}
+
+	SECTION("Erasing an element keeps the other handles valid") {
+		heap.erase(handles[3]);
+		heap.erase(handles[0]);
+
+		REQUIRE(heap.size() == 8);
+		REQUIRE(heap.top() == 10);
+		REQUIRE_THAT(heap, IsHeap());
+		for (std::size_t i : {1ULL, 2ULL, 4ULL, 5ULL, 6ULL, 7ULL, 8ULL, 9ULL})
+		{
+			REQUIRE(heap.value(handles[i]) == static_cast<int>(i) * 10);
+		}
+	}
+
+	SECTION("Handles of erased elements are given to new elements") {
+		heap.erase(handles[5]);
+		Indexed_Heap::Handle const handle = heap.push(55);
+
+		REQUIRE(handle == handles[5]);
+		REQUIRE(heap.value(handle) == 55);
+		REQUIRE_THAT(heap, IsHeap());
+	}
+
+	SECTION("Handles follow their elements in wider heaps") {
+		Quaternary_Heap                      wide;
+		std::vector<Quaternary_Heap::Handle> wide_handles;
+		for (int value = 0; value < 30; ++value)
+		{
+			wide_handles.push_back(wide.push(value));
+		}
+
+		wide.update(wide_handles[29], -5);
+		wide.erase(wide_handles[1]);
+		wide.pop();
+
+		REQUIRE(wide.top() == 0);
+		REQUIRE(wide.size() == 28);
+		REQUIRE_THAT(wide, IsHeap());
+		for (std::size_t i = 2; i < 29; ++i)
+		{
+			REQUIRE(wide.value(wide_handles[i]) == static_cast<int>(i));
+		}
+	}
+}
+
 } // namespace test
@@ -175,6 +175,18 @@ TEST_CASE("Elements can be inserted into the list", "[list]") {
 	}
 }
 
+TEST_CASE("Elements can be constructed in place inside of the list", "[list]") {
+	Handler_Scope scope;
+
+	List list{1, 2, 3};
+
+	auto &value = list.emplace(1, 0);
+
+	REQUIRE(value == 0);
+	REQUIRE(list.size() == 4);
+	REQUIRE_THAT(list, EqualsRange({1, 0, 2, 3}));
+}
+
 TEST_CASE("Elements can be erased from the list", "[list]") {
 	Handler_Scope scope;
 
@@ -221,4 +233,129 @@ TEST_CASE("Elements can be erased from the list", "[list]") {
 	}
 }
 
+TEST_CASE("Elements can be appended to the list", "[list]") {
+	Handler_Scope scope;
+
+	List list;
+
+	SECTION("Appending to an empty list sets its front and back") {
+		list.append(1);
+
+		REQUIRE(list.size() == 1);
+		REQUIRE(list.front() == 1);
+		REQUIRE(list.back() == 1);
+	}
+
+	SECTION("Appended elements follow the back") {
+		list.append(1);
+		list.append(2);
+		list.emplace_back(3);
+
+		REQUIRE(list.size() == 3);
+		REQUIRE(list.back() == 3);
+		REQUIRE_THAT(list, EqualsRange({1, 2, 3}));
+	}
+
+	SECTION("The back follows erasures of the last element") {
+		list.append(1);
+		list.append(2);
+		list.erase(1);
+		list.append(3);
+
+		REQUIRE(list.back() == 3);
+		REQUIRE_THAT(list, EqualsRange({1, 3}));
+
+		list.detatch_front();
+		list.detatch_front();
+		list.append(4);
+
+		REQUIRE(list.front() == 4);
+		REQUIRE(list.back() == 4);
+	}
+}
+
+TEST_CASE("Elements can be inserted and erased after iterators", "[list]") {
+	Handler_Scope scope;
+
+	List list{1, 2, 3};
+	auto first = list.begin();
+
+	SECTION("Elements can be inserted after an element") {
+		auto inserted = list.insert_after(first, 0);
+
+		REQUIRE(*inserted == 0);
+		REQUIRE(list.size() == 4);
+		REQUIRE_THAT(list, EqualsRange({1, 0, 2, 3}));
+	}
+
+	SECTION("Elements inserted after the last element become the back") {
+		auto last = list.begin();
+		++last;
+		++last;
+		list.emplace_after(last, 4);
+
+		REQUIRE(list.back() == 4);
+		REQUIRE_THAT(list, EqualsRange({1, 2, 3, 4}));
+	}
+
+	SECTION("Elements can be erased after an element") {
+		auto next = list.erase_after(first);
+
+		REQUIRE(*next == 3);
+		REQUIRE(list.size() == 2);
+		REQUIRE_THAT(list, EqualsRange({1, 3}));
+	}
+
+	SECTION("Erasing the last element moves the back") {
+		auto middle = list.begin();
+		++middle;
+
+		REQUIRE(list.erase_after(middle) == list.end());
+		REQUIRE(list.back() == 2);
+	}
+}
+
+TEST_CASE("Lists can be spliced into one another", "[list]") {
+	Handler_Scope scope;
+
+	List list{1, 2, 3};
+	List other{4, 5};
+
+	SECTION("Splicing after an element moves the other list into the middle") {
+		list.splice_after(list.begin(), other);
+
+		REQUIRE(other.empty());
+		REQUIRE(other.size() == 0);
+		REQUIRE(list.size() == 5);
+		REQUIRE(list.back() == 3);
+		REQUIRE_THAT(list, EqualsRange({1, 4, 5, 2, 3}));
+	}
+
+	SECTION("Splicing to the back moves the other list after the last element") {
+		list.splice_back(other);
+		list.append(6);
+
+		REQUIRE(other.empty());
+		REQUIRE(list.size() == 6);
+		REQUIRE_THAT(list, EqualsRange({1, 2, 3, 4, 5, 6}));
+	}
+
+	SECTION("Splicing into an empty list takes the other list") {
+		List empty;
+		empty.splice_back(list);
+
+		REQUIRE(list.empty());
+		REQUIRE(empty.front() == 1);
+		REQUIRE(empty.back() == 3);
+	}
+
+	SECTION("Splicing an empty list does nothing") {
+		List empty;
+		list.splice_back(empty);
+
+		REQUIRE(list.size() == 3);
+		REQUIRE(list.back() == 3);
+	}
+}
+
 } // namespace test
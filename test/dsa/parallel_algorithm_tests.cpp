@@ -0,0 +1,97 @@
+#include <dsa/algorithms.hpp>
+#include <dsa/dynamic_array.hpp>
+#include <dsa/parallel_algorithms.hpp>
+#include <dsa/work_stealing_pool.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace test
+{
+
+namespace
+{
+
+dsa::Dynamic_Array<int> scattered_values(std::size_t size) {
+	dsa::Dynamic_Array<int> array(size);
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		array[i] = static_cast<int>((i * 7'919) % size);
+	}
+	return array;
+}
+
+} // namespace
+
+TEST_CASE("Parallel merge sort correctly sorts an array", "[parallel_algorithms]") {
+	dsa::Work_Stealing_Pool pool(GENERATE(0ULL, 3ULL));
+
+	SECTION("Ranges below the grain size are sorted sequentially") {
+		dsa::Dynamic_Array array{9, 3, 8, 2, 1, 7, 5, 6, 4, 10};
+
+		dsa::parallel_merge_sort(pool, array.begin(), array.end(), std::less{});
+
+		REQUIRE(dsa::is_sorted(array.begin(), array.end()));
+	}
+
+	SECTION("Ranges above the grain size are split") {
+		std::size_t const grain_size = GENERATE(1ULL, 64ULL);
+
+		dsa::Dynamic_Array<int> array = scattered_values(1'000);
+		dsa::parallel_merge_sort(pool, array.begin(), array.end(), std::less{}, grain_size);
+
+		REQUIRE(dsa::is_sorted(array.begin(), array.end()));
+	}
+
+	SECTION("Equal elements keep their relative order") {
+		dsa::Dynamic_Array<std::pair<int, int>> pairs(1'000);
+		for (std::size_t i = 0; i < pairs.size(); ++i)
+		{
+			pairs[i] = {static_cast<int>((i * 7'919) % 13), static_cast<int>(i)};
+		}
+
+		auto by_key = [](auto const &lhs, auto const &rhs) {
+			return lhs.first < rhs.first;
+		};
+		dsa::parallel_merge_sort(pool, pairs.begin(), pairs.end(), by_key, 32);
+
+		REQUIRE(dsa::is_sorted(pairs.begin(), pairs.end(), std::less{}));
+	}
+}
+
+TEST_CASE("Parallel quick sort correctly sorts an array", "[parallel_algorithms]") {
+	dsa::Work_Stealing_Pool pool(GENERATE(0ULL, 3ULL));
+
+	SECTION("Ranges below the grain size are sorted sequentially") {
+		dsa::Dynamic_Array array{9, 3, 8, 2, 1, 7, 5, 6, 4, 10};
+
+		dsa::parallel_sort(pool, array.begin(), array.end(), std::less{});
+
+		REQUIRE(dsa::is_sorted(array.begin(), array.end()));
+	}
+
+	SECTION("Ranges above the grain size are split") {
+		std::size_t const grain_size = GENERATE(1ULL, 64ULL);
+
+		dsa::Dynamic_Array<int> array = scattered_values(1'000);
+		dsa::parallel_sort(pool, array.begin(), array.end(), std::greater{}, grain_size);
+
+		REQUIRE(dsa::is_sorted(array.begin(), array.end(), std::greater{}));
+	}
+}
+
+TEST_CASE("Parallel sorts can create their own pool", "[parallel_algorithms]") {
+	dsa::Dynamic_Array<int> array = scattered_values(50'000);
+	dsa::Dynamic_Array<int> copy  = array;
+
+	dsa::parallel_merge_sort(array.begin(), array.end(), std::less{}, 2);
+	dsa::parallel_sort(copy.begin(), copy.end());
+
+	REQUIRE(dsa::is_sorted(array.begin(), array.end()));
+	REQUIRE(array == copy);
+}
+
+} // namespace test
@@ -0,0 +1,176 @@
+#include "equals_range_matcher.hpp"
+
+#include <dsa/binary_tree.hpp>
+#include <dsa/list.hpp>
+#include <dsa/pool_allocator.hpp>
+#include <dsa/red_black_tree.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string>
+
+namespace test
+{
+
+TEST_CASE("Pool allocators hand out distinct aligned slots", "[pool_allocator]") {
+	dsa::Pool_Allocator<std::uint64_t, 4> allocator;
+
+	std::uint64_t *first  = allocator.allocate(1);
+	std::uint64_t *second = allocator.allocate(1);
+
+	SECTION("Consecutive slots of a block are adjacent") {
+		REQUIRE(second == first + 1);
+	}
+
+	SECTION("Slots are aligned for the value type") {
+		REQUIRE(reinterpret_cast<std::uintptr_t>(first) % alignof(std::uint64_t) == 0);
+		REQUIRE(reinterpret_cast<std::uintptr_t>(second) % alignof(std::uint64_t) == 0);
+	}
+
+	SECTION("A new block is started once the current one is exhausted") {
+		std::uint64_t *slots[8];
+		for (auto &slot : slots)
+		{
+			slot  = allocator.allocate(1);
+			*slot = 0;
+		}
+
+		std::sort(std::begin(slots), std::end(slots));
+		REQUIRE(std::adjacent_find(std::begin(slots), std::end(slots)) == std::end(slots));
+	}
+
+	allocator.deallocate(second, 1);
+	allocator.deallocate(first, 1);
+}
+
+TEST_CASE("Pool allocators reuse deallocated slots", "[pool_allocator]") {
+	dsa::Pool_Allocator<int> allocator;
+
+	int *first  = allocator.allocate(1);
+	int *second = allocator.allocate(1);
+	allocator.deallocate(first, 1);
+
+	REQUIRE(allocator.allocate(1) == first);
+	allocator.deallocate(first, 1);
+	allocator.deallocate(second, 1);
+}
+
+TEST_CASE("Pool allocators forward array allocations", "[pool_allocator]") {
+	dsa::Pool_Allocator<int> allocator;
+
+	int *array = allocator.allocate(3);
+	array[0]   = 0;
+	array[2]   = 2;
+
+	REQUIRE(array[2] - array[0] == 2);
+	allocator.deallocate(array, 3);
+}
+
+TEST_CASE("Pool allocators can be used by node based containers", "[pool_allocator]") {
+	SECTION("Lists allocate their nodes from the pool") {
+		using List = dsa::List<std::string, dsa::Pool_Allocator<std::string>>;
+
+		List list{"a", "b"};
+		list.insert(1, "c");
+		list.erase(0);
+
+		List copy = list;
+		copy.prepend("d");
+
+		REQUIRE_THAT(list, EqualsRange(std::initializer_list<std::string>{"c", "b"}));
+		REQUIRE_THAT(copy, EqualsRange(std::initializer_list<std::string>{"d", "c", "b"}));
+	}
+
+	SECTION("Binary trees allocate their nodes from the pool") {
+		using Binary_Tree = dsa::Binary_Tree<int, dsa::Pool_Allocator<int, 2>>;
+
+		Binary_Tree binary_tree{2, 0, 1, 3, 4};
+		binary_tree.erase(1);
+
+		Binary_Tree moved = std::move(binary_tree);
+		moved.insert(5);
+
+		REQUIRE_THAT(moved, EqualsRange({0, 2, 3, 4, 5}));
+	}
+}
+
+TEST_CASE("Node based containers take their pool with them when moved", "[pool_allocator]") {
+	SECTION("Moved lists outlive the list they were moved from") {
+		using List = dsa::List<std::string, dsa::Pool_Allocator<std::string>>;
+
+		std::optional<List> source(List{"a", "b", "c"});
+		List                moved(std::move(*source));
+		source.reset();
+
+		REQUIRE_THAT(moved, EqualsRange(std::initializer_list<std::string>{"a", "b", "c"}));
+	}
+
+	SECTION("Move assigned lists outlive the list they were moved from") {
+		using List = dsa::List<std::string, dsa::Pool_Allocator<std::string>>;
+
+		std::optional<List> source(List{"a", "b"});
+		List                moved{"d"};
+		moved = std::move(*source);
+		source.reset();
+
+		REQUIRE_THAT(moved, EqualsRange(std::initializer_list<std::string>{"a", "b"}));
+	}
+
+	SECTION("Moved binary trees outlive the tree they were moved from") {
+		using Binary_Tree = dsa::Binary_Tree<int, dsa::Pool_Allocator<int, 2>>;
+
+		std::optional<Binary_Tree> source(Binary_Tree{2, 0, 1, 3, 4});
+		Binary_Tree                moved(std::move(*source));
+		source.reset();
+
+		REQUIRE_THAT(moved, EqualsRange({0, 1, 2, 3, 4}));
+	}
+
+	SECTION("Move assigned binary trees outlive the tree they were moved from") {
+		using Binary_Tree = dsa::Binary_Tree<int, dsa::Pool_Allocator<int, 2>>;
+
+		std::optional<Binary_Tree> source(Binary_Tree{2, 0, 1});
+		Binary_Tree                moved{5};
+		moved = std::move(*source);
+		source.reset();
+
+		REQUIRE_THAT(moved, EqualsRange({0, 1, 2}));
+	}
+
+	SECTION("Copied red black trees outlive the tree they were copied from") {
+		using Red_Black_Tree = dsa::Red_Black_Tree<int, dsa::Pool_Allocator<int, 2>>;
+
+		std::optional<Red_Black_Tree> source(Red_Black_Tree{2, 0, 1, 3, 4});
+		Red_Black_Tree                copy(*source);
+		source.reset();
+
+		REQUIRE_THAT(copy, EqualsRange({0, 1, 2, 3, 4}));
+	}
+
+	SECTION("Moved red black trees outlive the tree they were moved from") {
+		using Red_Black_Tree = dsa::Red_Black_Tree<int, dsa::Pool_Allocator<int, 2>>;
+
+		std::optional<Red_Black_Tree> source(Red_Black_Tree{2, 0, 1, 3, 4});
+		Red_Black_Tree                moved(std::move(*source));
+		source.reset();
+
+		REQUIRE_THAT(moved, EqualsRange({0, 1, 2, 3, 4}));
+	}
+
+	SECTION("Move assigned red black trees outlive the tree they were moved from") {
+		using Red_Black_Tree = dsa::Red_Black_Tree<int, dsa::Pool_Allocator<int, 2>>;
+
+		std::optional<Red_Black_Tree> source(Red_Black_Tree{2, 0, 1});
+		Red_Black_Tree                moved{5};
+		moved = std::move(*source);
+		source.reset();
+
+		REQUIRE_THAT(moved, EqualsRange({0, 1, 2}));
+	}
+}
+
+} // namespace test
@@ -0,0 +1,231 @@
+#include "allocation_verifier.hpp"
+#include "equals_range_matcher.hpp"
+#include "memory_monitor_handler_scope.hpp"
+
+#include <dsa/memory_monitor.hpp>
+#include <dsa/red_black_tree.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <utility>
+
+namespace test
+{
+
+using Value          = int;
+using Allocator      = dsa::Memory_Monitor<Value, Allocation_Verifier>;
+using Handler_Scope  = Memory_Monitor_Handler_Scope<Allocation_Verifier>;
+using Red_Black_Tree = dsa::Red_Black_Tree<Value, Allocator>;
+
+namespace
+{
+
+/// A red black tree of the given size is at most twice as high as a perfectly
+/// balanced tree
+bool is_balanced(std::size_t height, std::size_t size) {
+	return std::cmp_less_equal(height, 2 * std::bit_width(size));
+}
+
+} // namespace
+
+TEST_CASE("Various mechanisims to initialise red black tree", "[red_black_tree]") {
+	Handler_Scope scope;
+
+	SECTION("Default initialised red black tree has no elements") {
+		Red_Black_Tree tree;
+
+		REQUIRE(tree.empty());
+		REQUIRE(tree.size() == 0);
+		REQUIRE(tree.begin() == tree.end());
+	}
+
+	SECTION("Construct using red black tree initialisation") {
+		Red_Black_Tree tree{3, 1, 2};
+
+		REQUIRE_FALSE(tree.empty());
+		REQUIRE(tree.size() == 3);
+		REQUIRE_THAT(tree, EqualsRange({1, 2, 3}));
+	}
+}
+
+TEST_CASE("Red black trees can be compared", "[red_black_tree]") {
+	Handler_Scope scope;
+
+	SECTION("Empty red black trees are equal") {
+		REQUIRE(Red_Black_Tree() == Red_Black_Tree());
+	}
+
+	SECTION("Red black trees with a differing element are unequal") {
+		REQUIRE(Red_Black_Tree{0, 1} != Red_Black_Tree{0, 2});
+		REQUIRE(Red_Black_Tree{0} != Red_Black_Tree{0, 1});
+	}
+
+	SECTION("Insertion order does not affect equality") {
+		REQUIRE(Red_Black_Tree{1, 2, 3, 4} == Red_Black_Tree{4, 2, 1, 3});
+	}
+}
+
+TEST_CASE("Red black trees can be copied and moved", "[red_black_tree]") {
+	Handler_Scope scope;
+
+	Red_Black_Tree tree{0, 1, 2, 3, 4};
+
+	SECTION("Copies hold the same elements") {
+		Red_Black_Tree copy(tree);
+		copy.erase(0);
+
+		REQUIRE_THAT(copy, EqualsRange({1, 2, 3, 4}));
+		REQUIRE_THAT(tree, EqualsRange({0, 1, 2, 3, 4}));
+	}
+
+	SECTION("Copy assignment replaces the elements") {
+		Red_Black_Tree copy{7};
+		copy = tree;
+
+		REQUIRE(copy == tree);
+		REQUIRE(copy.size() == 5);
+	}
+
+	SECTION("Moves take the elements") {
+		Red_Black_Tree moved(std::move(tree));
+
+		REQUIRE_THAT(moved, EqualsRange({0, 1, 2, 3, 4}));
+	}
+
+	SECTION("Red black trees can be swapped") {
+		Red_Black_Tree other{9};
+		swap(tree, other);
+
+		REQUIRE_THAT(tree, EqualsRange({9}));
+		REQUIRE(other.size() == 5);
+	}
+}
+
+TEST_CASE("Red black trees find their elements", "[red_black_tree]") {
+	Handler_Scope scope;
+
+	Red_Black_Tree tree{0, -1, 1};
+
+	REQUIRE(tree.contains(1));
+	REQUIRE_FALSE(tree.contains(2));
+	REQUIRE(*tree.find(-1) == -1);
+	REQUIRE(tree.find(2) == tree.end());
+}
+
+TEST_CASE("Elements can be constructed in place inside of the red black tree", "[red_black_tree]") {
+	Handler_Scope scope;
+
+	Red_Black_Tree tree{0, -2, 2};
+
+	auto iterator = tree.emplace(1);
+
+	REQUIRE(*iterator == 1);
+	REQUIRE_THAT(tree, EqualsRange({-2, 0, 1, 2}));
+}
+
+TEST_CASE("Red black trees keep equal elements", "[red_black_tree]") {
+	Handler_Scope scope;
+
+	Red_Black_Tree tree{1, 1, 0, 1};
+
+	REQUIRE_THAT(tree, EqualsRange({0, 1, 1, 1}));
+	REQUIRE(tree.erase(1));
+	REQUIRE_THAT(tree, EqualsRange({0, 1, 1}));
+}
+
+TEST_CASE("Elements can be erased from the red black tree", "[red_black_tree]") {
+	Handler_Scope scope;
+
+	Red_Black_Tree tree;
+	for (int value = 0; value < 10; ++value)
+	{
+		tree.insert(value);
+	}
+
+	SECTION("Erasing an absent element does nothing") {
+		REQUIRE_FALSE(tree.erase(10));
+		REQUIRE(tree.size() == 10);
+	}
+
+	SECTION("Erasing every element empties the tree") {
+		for (int value = 0; value < 10; ++value)
+		{
+			REQUIRE(tree.erase(value));
+		}
+
+		REQUIRE(tree.empty());
+		REQUIRE(tree == Red_Black_Tree());
+	}
+
+	SECTION("Erasing keeps iterators to other elements valid") {
+		auto const five = tree.find(5);
+		for (int value = 0; value < 10; ++value)
+		{
+			if (value != 5)
+			{
+				tree.erase(value);
+			}
+		}
+
+		REQUIRE(*five == 5);
+		REQUIRE(tree.begin() == five);
+	}
+
+	SECTION("Clear erases all elements from the tree") {
+		tree.clear();
+
+		REQUIRE(tree.empty());
+		REQUIRE(tree.size() == 0);
+	}
+}
+
+TEST_CASE("Red black trees stay balanced", "[red_black_tree]") {
+	SECTION("Sorted insertions keep the height logarithmic") {
+		dsa::Red_Black_Tree<int> tree;
+		for (int value = 0; value < 100'000; ++value)
+		{
+			tree.insert(value);
+		}
+
+		REQUIRE(tree.size() == 100'000);
+		REQUIRE(is_balanced(tree.height(), tree.size()));
+		REQUIRE(tree.contains(99'999));
+	}
+
+	SECTION("Random insertions and erasures match std::multiset") {
+		std::mt19937                       generator(42);
+		std::uniform_int_distribution<int> values(0, 300);
+
+		dsa::Red_Black_Tree<int> tree;
+		std::multiset<int>       expected;
+		for (int operation = 0; operation < 10'000; ++operation)
+		{
+			int const value = values(generator);
+			if (operation % 3 == 0)
+			{
+				auto const element = expected.find(value);
+				REQUIRE(tree.erase(value) == (element != expected.end()));
+				if (element != expected.end())
+				{
+					expected.erase(element);
+				}
+			}
+			else
+			{
+				tree.insert(value);
+				expected.insert(value);
+			}
+
+			REQUIRE(is_balanced(tree.height(), tree.size()));
+		}
+
+		REQUIRE(tree.size() == expected.size());
+		REQUIRE_THAT(tree, EqualsRange(expected));
+	}
+}
+
+} // namespace test
@@ -0,0 +1,274 @@
+#include "allocation_verifier.hpp"
+#include "equals_range_matcher.hpp"
+#include "memory_monitor_handler_scope.hpp"
+
+#include <dsa/memory_monitor.hpp>
+#include <dsa/ring_deque.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace test
+{
+
+using Value      = int;
+using Allocator  = dsa::Memory_Monitor<Value, Allocation_Verifier>;
+using Ring_Deque = dsa::Ring_Deque<Value, Allocator>;
+
+using Handler_Scope = Memory_Monitor_Handler_Scope<Allocation_Verifier>;
+
+TEST_CASE("Ring deques provide multiple constructors for easy initialisation", "[ring_deque]") {
+	Handler_Scope scope;
+
+	SECTION("Default initialised ring deques are empty and hold no storage") {
+		Ring_Deque deque;
+
+		REQUIRE(deque.empty());
+		REQUIRE(deque.size() == 0);
+		REQUIRE(deque.capacity() == 0);
+	}
+
+	SECTION("Construct using list initialisation") {
+		std::initializer_list<int> list{1, 2, 3};
+
+		Ring_Deque deque(list);
+
+		REQUIRE(deque.size() == list.size());
+		REQUIRE(deque.capacity() == 4);
+		REQUIRE_THAT(deque, EqualsRange(list));
+	}
+}
+
+TEST_CASE("Ring deques can be compared", "[ring_deque]") {
+	Handler_Scope scope;
+
+	SECTION("Empty ring deques are equal") {
+		REQUIRE(Ring_Deque() == Ring_Deque());
+	}
+
+	SECTION("Ring deques with differing sizes are unequal") {
+		REQUIRE(Ring_Deque{1, 2} != Ring_Deque{1, 2, 3});
+	}
+
+	SECTION("Ring deques with differing elements are unequal") {
+		REQUIRE(Ring_Deque{1, 2, 3} != Ring_Deque{1, 5, 3});
+	}
+
+	SECTION("Ring deques holding the same elements at different positions are equal") {
+		Ring_Deque lhs{2, 3};
+		Ring_Deque rhs{1, 2};
+		rhs.pop_front();
+		rhs.append(3);
+
+		REQUIRE(lhs == rhs);
+	}
+}
+
+TEST_CASE("Ring deques can be copied, moved and swapped", "[ring_deque]") {
+	Handler_Scope scope;
+
+	Ring_Deque deque{1, 2, 3};
+	deque.prepend(0);
+
+	SECTION("Ring deques can be copy constructed from another ring deque") {
+		Ring_Deque copy(deque);
+
+		REQUIRE(copy == deque);
+		REQUIRE_THAT(copy, EqualsRange({0, 1, 2, 3}));
+	}
+
+	SECTION("Ring deques can be copy assigned from another ring deque") {
+		Ring_Deque copy{5};
+		copy = deque;
+
+		REQUIRE(copy == deque);
+	}
+
+	SECTION("Ring deques can be move constructed from another ring deque") {
+		Ring_Deque moved(std::move(deque));
+
+		REQUIRE_THAT(moved, EqualsRange({0, 1, 2, 3}));
+	}
+
+	SECTION("Ring deques can be move assigned from another ring deque") {
+		Ring_Deque moved{5};
+		moved = std::move(deque);
+
+		REQUIRE_THAT(moved, EqualsRange({0, 1, 2, 3}));
+	}
+
+	SECTION("Ring deques can be swapped") {
+		Ring_Deque other{5, 6};
+
+		swap(deque, other);
+
+		REQUIRE_THAT(deque, EqualsRange({5, 6}));
+		REQUIRE_THAT(other, EqualsRange({0, 1, 2, 3}));
+	}
+}
+
+TEST_CASE("Elements can be added and removed at both ends", "[ring_deque]") {
+	Handler_Scope scope;
+
+	Ring_Deque deque;
+
+	SECTION("Elements can be added to the back") {
+		deque.append(1);
+		deque.append(2);
+		deque.emplace_back(3);
+
+		REQUIRE(deque.front() == 1);
+		REQUIRE(deque.back() == 3);
+		REQUIRE_THAT(deque, EqualsRange({1, 2, 3}));
+	}
+
+	SECTION("Elements can be added to the front") {
+		deque.prepend(1);
+		deque.prepend(2);
+		deque.emplace_front(3);
+
+		REQUIRE(deque.front() == 3);
+		REQUIRE(deque.back() == 1);
+		REQUIRE_THAT(deque, EqualsRange({3, 2, 1}));
+	}
+
+	SECTION("Elements can be removed from either end") {
+		deque = Ring_Deque{1, 2, 3, 4};
+
+		deque.pop_front();
+		deque.pop_back();
+
+		REQUIRE_THAT(deque, EqualsRange({2, 3}));
+	}
+
+	SECTION("Clearing erases all elements and keeps the storage") {
+		deque = Ring_Deque{1, 2, 3};
+
+		deque.clear();
+
+		REQUIRE(deque.empty());
+		REQUIRE(deque.capacity() == 4);
+	}
+}
+
+TEST_CASE("Ring deques grow by doubling their capacity", "[ring_deque]") {
+	Handler_Scope scope;
+
+	Ring_Deque deque;
+
+	SECTION("The capacity stays a power of two while growing") {
+		for (int i = 0; i < 100; ++i)
+		{
+			deque.append(i);
+			REQUIRE(std::has_single_bit(deque.capacity()));
+		}
+
+		REQUIRE(deque.size() == 100);
+		REQUIRE(deque.capacity() == 128);
+	}
+
+	SECTION("Elements wrapping around the end of the ring keep their order when growing") {
+		deque = Ring_Deque{2, 3, 4, 5};
+		deque.pop_back();
+		deque.prepend(1);
+		deque.pop_back();
+		deque.prepend(0);
+		REQUIRE(deque.capacity() == 4);
+
+		deque.append(4);
+		deque.append(5);
+
+		REQUIRE(deque.capacity() == 8);
+		REQUIRE_THAT(deque, EqualsRange({0, 1, 2, 3, 4, 5}));
+	}
+
+	SECTION("Elements can be added from a reference to one held while growing") {
+		deque = Ring_Deque{1, 2};
+		deque.emplace_back(deque.front());
+		deque.append(3);
+
+		deque.emplace_front(deque.back());
+
+		REQUIRE_THAT(deque, EqualsRange({3, 1, 2, 1, 3}));
+	}
+
+	SECTION("Reserving rounds the capacity up to a power of two") {
+		deque.reserve(5);
+
+		REQUIRE(deque.capacity() == 8);
+	}
+}
+
+TEST_CASE("Ring deques can be used as a bounded queue", "[ring_deque]") {
+	dsa::Ring_Deque<std::string> deque;
+	deque.reserve(2);
+
+	SECTION("Empty ring deques have nothing to pop") {
+		REQUIRE_FALSE(deque.try_pop().has_value());
+	}
+
+	SECTION("Elements are popped first in first out until the deque is full") {
+		std::string const copied = "copied";
+
+		REQUIRE(deque.try_push(copied));
+		REQUIRE(deque.try_push("moved"));
+		REQUIRE_FALSE(deque.try_push("refused"));
+		REQUIRE(deque.capacity() == 2);
+
+		REQUIRE(deque.try_pop() == "copied");
+		REQUIRE(deque.try_pop() == "moved");
+		REQUIRE_FALSE(deque.try_pop().has_value());
+	}
+
+	SECTION("Ring deques without storage refuse every push") {
+		dsa::Ring_Deque<std::string> unreserved;
+
+		REQUIRE_FALSE(unreserved.try_push("refused"));
+	}
+}
+
+TEST_CASE("Ring deques hand elements from a producer thread to a consumer thread", "[ring_deque]") {
+	constexpr std::size_t count = 100'000;
+
+	dsa::Ring_Deque<std::size_t> deque;
+	deque.reserve(64);
+
+	std::thread producer([&deque] {
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			while (!deque.try_push(std::size_t{i}))
+			{
+				std::this_thread::yield();
+			}
+		}
+	});
+
+	std::vector<std::size_t> popped;
+	popped.reserve(count);
+	while (popped.size() < count)
+	{
+		if (auto const value = deque.try_pop())
+		{
+			popped.push_back(*value);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+	producer.join();
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		REQUIRE(popped[i] == i);
+	}
+	REQUIRE(deque.empty());
+}
+
+} // namespace test
@@ -0,0 +1,231 @@
+#include "equals_range_matcher.hpp"
+
+#include <dsa/unrolled_list.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace test
+{
+
+namespace
+{
+
+/// Nodes hold four elements, so a handful of elements already spans several
+/// nodes which split and merge
+using Unrolled_List = dsa::Unrolled_List<int, 4>;
+
+/// Remembers whether it was built by moving another value
+struct Move_Tracked
+{
+	int  m_value = 0;
+	bool m_moved = false;
+
+	explicit Move_Tracked(int value) : m_value(value) {
+	}
+
+	Move_Tracked(Move_Tracked &&other) noexcept : m_value(other.m_value), m_moved(true) {
+	}
+
+	Move_Tracked &operator=(Move_Tracked &&other) noexcept {
+		m_value = other.m_value;
+		m_moved = true;
+		return *this;
+	}
+
+	Move_Tracked(Move_Tracked const &)            = delete;
+	Move_Tracked &operator=(Move_Tracked const &) = delete;
+	~Move_Tracked()                               = default;
+};
+
+} // namespace
+
+TEST_CASE("Various mechanisims to initialise unrolled lists", "[unrolled_list]") {
+	SECTION("Default initialised unrolled list has no elements") {
+		Unrolled_List list;
+
+		REQUIRE(list.empty());
+		REQUIRE(list.size() == 0);
+		REQUIRE(list.begin() == list.end());
+	}
+
+	SECTION("Construct using list initialisation") {
+		std::initializer_list<int> values{1, 2, 3, 4, 5, 6};
+		Unrolled_List              list(values);
+
+		REQUIRE(list.size() == 6);
+		REQUIRE(list.front() == 1);
+		REQUIRE(list.back() == 6);
+		REQUIRE_THAT(list, EqualsRange(values));
+	}
+}
+
+TEST_CASE("Unrolled lists can be copied and moved", "[unrolled_list]") {
+	dsa::Unrolled_List<std::string, 2> list{"a", "b", "c", "d", "e"};
+
+	SECTION("Copies hold the same elements") {
+		auto copy = list;
+		copy.erase(0);
+
+		REQUIRE(copy != list);
+		REQUIRE(list.front() == "a");
+
+		copy.prepend("a");
+		REQUIRE(copy == list);
+	}
+
+	SECTION("Moves take the elements") {
+		auto moved = std::move(list);
+
+		REQUIRE(moved.size() == 5);
+		REQUIRE(moved.back() == "e");
+	}
+
+	SECTION("Unrolled lists can be swapped") {
+		dsa::Unrolled_List<std::string, 2> other{"z"};
+		swap(list, other);
+
+		REQUIRE(list.size() == 1);
+		REQUIRE(other.size() == 5);
+	}
+}
+
+TEST_CASE("Elements can be inserted into unrolled lists", "[unrolled_list]") {
+	Unrolled_List list{1, 2, 3, 4};
+
+	SECTION("Elements can be added to the front with prepend") {
+		list.prepend(0);
+
+		REQUIRE(list.size() == 5);
+		REQUIRE_THAT(list, EqualsRange({0, 1, 2, 3, 4}));
+	}
+
+	SECTION("Elements can be appended to the back") {
+		list.append(5);
+		list.emplace_back(6);
+
+		REQUIRE(list.back() == 6);
+		REQUIRE_THAT(list, EqualsRange({1, 2, 3, 4, 5, 6}));
+	}
+
+	SECTION("Inserting into a full node splits it") {
+		list.insert(1, 0);
+		list.insert(4, 0);
+
+		REQUIRE(list.size() == 6);
+		REQUIRE_THAT(list, EqualsRange({1, 0, 2, 3, 0, 4}));
+	}
+
+	SECTION("Elements can be constructed in place") {
+		auto &value = list.emplace(2, 7);
+
+		REQUIRE(value == 7);
+		REQUIRE_THAT(list, EqualsRange({1, 2, 7, 3, 4}));
+	}
+
+	SECTION("Elements at the end of a node with room are constructed inside of it") {
+		dsa::Unrolled_List<Move_Tracked, 4> tracked;
+		for (int value : {1, 2, 3, 4})
+		{
+			tracked.emplace_back(value);
+		}
+
+		// Splitting leaves room at the end of the first node
+		tracked.emplace(1, 0);
+		auto &value = tracked.emplace(3, 7);
+
+		REQUIRE(value.m_value == 7);
+		REQUIRE_FALSE(value.m_moved);
+		REQUIRE(tracked.size() == 6);
+	}
+
+	SECTION("Elements can be inserted from an element of a full node") {
+		// Splitting the node moves the element which is being copied
+		dsa::Unrolled_List<std::string, 4> strings{"a", "b", "c", "d"};
+		strings.emplace(0, strings.back());
+
+		REQUIRE(strings.size() == 5);
+		REQUIRE(strings.front() == "d");
+		REQUIRE(strings.back() == "d");
+	}
+}
+
+TEST_CASE("Elements can be erased from unrolled lists", "[unrolled_list]") {
+	Unrolled_List list{1, 2, 3, 4, 5, 6, 7, 8};
+
+	SECTION("Front elements can be erased with detatch_front") {
+		list.detatch_front();
+
+		REQUIRE(list.front() == 2);
+		REQUIRE(list.size() == 7);
+	}
+
+	SECTION("Elements can be erased across nodes") {
+		list.erase(7);
+		list.erase(3);
+		list.erase(1);
+
+		REQUIRE(list.back() == 7);
+		REQUIRE_THAT(list, EqualsRange({1, 3, 5, 6, 7}));
+	}
+
+	SECTION("Erasing every element empties the list") {
+		while (!list.empty())
+		{
+			list.erase(list.size() / 2);
+		}
+
+		REQUIRE(list.size() == 0);
+		REQUIRE(list.begin() == list.end());
+	}
+
+	SECTION("All elements can be erased with clear") {
+		list.clear();
+		list.append(1);
+
+		REQUIRE(list.size() == 1);
+		REQUIRE(list.front() == 1);
+	}
+}
+
+TEST_CASE("Unrolled lists match std::vector under random operations", "[unrolled_list]") {
+	std::mt19937     generator(42);
+	Unrolled_List    list;
+	std::vector<int> expected;
+	for (int operation = 0; operation < 10'000; ++operation)
+	{
+		std::size_t const index  = expected.empty() ? 0 : generator() % expected.size();
+		auto const        offset = static_cast<std::ptrdiff_t>(index);
+		switch (generator() % 4)
+		{
+		case 0:
+			list.prepend(operation);
+			expected.insert(expected.begin(), operation);
+			break;
+		case 1:
+			list.append(operation);
+			expected.push_back(operation);
+			break;
+		case 2:
+			list.insert(index, operation);
+			expected.insert(expected.begin() + offset, operation);
+			break;
+		default:
+			if (!expected.empty())
+			{
+				list.erase(index);
+				expected.erase(expected.begin() + offset);
+			}
+			break;
+		}
+	}
+
+	REQUIRE(list.size() == expected.size());
+	REQUIRE_THAT(list, EqualsRange(expected));
+}
+
+} // namespace test
@@ -1,5 +1,6 @@
 #include "allocation_verifier.hpp"
 #include "equals_range_matcher.hpp"
+#include "expandable_allocator.hpp"
 #include "memory_monitor_handler_scope.hpp"
 
 #include <dsa/memory_monitor.hpp>
@@ -215,6 +216,62 @@ TEST_CASE("Elements can be appended to the vector", "[vector]") {
 	REQUIRE_THAT(vector, EqualsRange(expected));
 }
 
+TEST_CASE("Elements can be constructed in place inside of the vector", "[vector]") {
+	Handler_Scope scope;
+
+	Vector vector{0, 1, 2};
+
+	SECTION("Elements can be constructed at the end with emplace_back") {
+		auto &value = vector.emplace_back(3);
+
+		REQUIRE(value == 3);
+		REQUIRE(&value == &vector.back());
+		REQUIRE_THAT(vector, EqualsRange({0, 1, 2, 3}));
+	}
+
+	SECTION("Elements can be constructed at any index with emplace") {
+		auto &value = vector.emplace(1ULL, 3);
+
+		REQUIRE(value == 3);
+		REQUIRE(&value == &vector[1]);
+		REQUIRE_THAT(vector, EqualsRange({0, 3, 1, 2}));
+	}
+
+	SECTION("Elements can be constructed from elements of the same vector") {
+		vector.reserve(8);
+		vector.emplace(0ULL, vector[2]);
+		vector.emplace(0ULL, vector.back());
+
+		REQUIRE_THAT(vector, EqualsRange({2, 2, 0, 1, 2}));
+	}
+}
+
+TEST_CASE("Vectors grow in place when the allocator supports it", "[vector]") {
+	dsa::Vector<int, Expandable_Allocator<int>> vector;
+	vector.append(0);
+
+	int *const storage = vector.data();
+
+	SECTION("Appending elements keeps the same storage") {
+		vector.append(1);
+		vector.append(2);
+		vector.append(3);
+
+		REQUIRE(vector.data() == storage);
+		REQUIRE(vector.allocator().expansions() == 3);
+		REQUIRE_THAT(vector, EqualsRange({0, 1, 2, 3}));
+	}
+
+	SECTION("Inserting elements keeps the same storage") {
+		vector.insert(0ULL, 1);
+		vector.insert(1ULL, 2);
+
+		REQUIRE(vector.data() == storage);
+		REQUIRE(vector.allocator().expansions() == 3);
+		REQUIRE_THAT(vector, EqualsRange({1, 2, 0}));
+	}
+}
+
 TEST_CASE("Elements can be inserted into the vector", "[vector]") {
 	Handler_Scope scope;
 
@@ -279,6 +336,29 @@ TEST_CASE("Elements can be inserted into the vector", "[vector]") {
 	}
 }
 
+TEST_CASE("Vectors of trivially relocatable values relocate elements in bulk", "[vector]") {
+	dsa::Vector<int> vector{1, 2, 3};
+
+	SECTION("Reallocation preserves elements") {
+		vector.reserve(vector.capacity() * 2);
+
+		REQUIRE_THAT(vector, EqualsRange({1, 2, 3}));
+	}
+
+	SECTION("Insertion shifts later elements backwards") {
+		vector.reserve(vector.capacity() * 2);
+		vector.insert(1ULL, 4);
+
+		REQUIRE_THAT(vector, EqualsRange({1, 4, 2, 3}));
+	}
+
+	SECTION("Erasing shifts later elements forward") {
+		vector.erase(0ULL);
+
+		REQUIRE_THAT(vector, EqualsRange({2, 3}));
+	}
+}
+
 TEST_CASE("Elements can be erased from the vector", "[vector]") {
 	Handler_Scope scope;
 
@@ -312,6 +392,153 @@ TEST_CASE("Elements can be erased from the vector", "[vector]") {
 	}
 }
 
+TEST_CASE("Ranges of elements can be added to the vector at once", "[vector]") {
+	Handler_Scope scope;
+
+	std::initializer_list<int> range{7, 8, 9};
+
+	SECTION("Appending a range grows the storage once") {
+		Vector vector{1, 2};
+
+		vector.append_range(range.begin(), range.end());
+
+		REQUIRE(vector.capacity() == 5ULL);
+		REQUIRE_THAT(vector, EqualsRange({1, 2, 7, 8, 9}));
+	}
+
+	SECTION("Appending an empty range leaves the vector unchanged") {
+		Vector vector{1, 2};
+
+		vector.append_range(range.begin(), range.begin());
+
+		REQUIRE_THAT(vector, EqualsRange({1, 2}));
+	}
+
+	SECTION("Inserting a range with reallocation preserves previous elements") {
+		Vector vector{1, 2, 3};
+
+		vector.insert_range(1ULL, range.begin(), range.end());
+
+		REQUIRE_THAT(vector, EqualsRange({1, 7, 8, 9, 2, 3}));
+	}
+
+	SECTION("Inserting a range without reallocation shifts later elements backwards") {
+		Vector vector{1, 2, 3};
+		vector.reserve(8ULL);
+
+		vector.insert_range(1ULL, range.begin(), range.end());
+
+		REQUIRE(vector.capacity() == 8ULL);
+		REQUIRE_THAT(vector, EqualsRange({1, 7, 8, 9, 2, 3}));
+	}
+
+	SECTION("Elements of the vector can be inserted without reallocation") {
+		// Monitored pointers are not standard iterators, so the range is
+		// taken from a vector using raw pointers
+		dsa::Vector<Value> vector{1, 2, 3, 4, 5};
+		vector.reserve(20ULL);
+
+		vector.insert_range(0ULL, vector.begin() + 1, vector.begin() + 3);
+
+		REQUIRE_THAT(vector, EqualsRange({2, 3, 1, 2, 3, 4, 5}));
+	}
+
+	SECTION("Elements of the vector can be inserted with reallocation") {
+		dsa::Vector<Value> vector{1, 2, 3, 4, 5};
+
+		vector.insert_range(2ULL, vector.begin(), vector.end());
+
+		REQUIRE_THAT(vector, EqualsRange({1, 2, 1, 2, 3, 4, 5, 3, 4, 5}));
+	}
+}
+
+TEST_CASE("Ranges of elements can be erased from the vector", "[vector]") {
+	Handler_Scope scope;
+
+	Vector vector{1, 2, 3, 4, 5};
+
+	SECTION("Erasing a middle range shifts later elements forward") {
+		vector.erase_range(1ULL, 3ULL);
+
+		REQUIRE_THAT(vector, EqualsRange({1, 4, 5}));
+	}
+
+	SECTION("Erasing the last elements preserves earlier elements") {
+		vector.erase_range(3ULL, 5ULL);
+
+		REQUIRE_THAT(vector, EqualsRange({1, 2, 3}));
+	}
+
+	SECTION("Erasing most elements shrinks the storage") {
+		vector.erase_range(0ULL, 4ULL);
+
+		REQUIRE(vector.capacity() < 5ULL);
+		REQUIRE_THAT(vector, EqualsRange({5}));
+	}
+
+	SECTION("Erasing an empty range leaves the vector unchanged") {
+		vector.erase_range(2ULL, 2ULL);
+
+		REQUIRE_THAT(vector, EqualsRange({1, 2, 3, 4, 5}));
+	}
+}
+
+TEST_CASE("Vectors use a growth policy to decide their capacity", "[vector]") {
+	Handler_Scope scope;
+
+	SECTION("The default policy halves the capacity once a quarter is in use") {
+		Vector vector{1, 2, 3, 4, 5, 6, 7, 8};
+
+		for (int i = 0; i < 5; ++i)
+		{
+			vector.erase(0ULL);
+		}
+
+		REQUIRE(vector.capacity() == 8ULL);
+
+		vector.erase(0ULL);
+
+		REQUIRE(vector.capacity() == 4ULL);
+		REQUIRE_THAT(vector, EqualsRange({7, 8}));
+	}
+
+	SECTION("The default policy halves the capacity only once per removal") {
+		Vector vector{1};
+		vector.reserve(16ULL);
+
+		vector.erase(0ULL);
+
+		REQUIRE(vector.empty());
+		REQUIRE(vector.capacity() == 8ULL);
+	}
+
+	SECTION("The never shrink policy keeps the capacity when elements are removed") {
+		dsa::Vector<Value, Allocator, dsa::Never_Shrink_Growth_Policy> vector{1, 2, 3, 4};
+
+		vector.erase(0ULL);
+		vector.erase(0ULL);
+		vector.erase(0ULL);
+		REQUIRE(vector.capacity() == 4ULL);
+
+		vector.resize(0ULL);
+		REQUIRE(vector.capacity() == 4ULL);
+	}
+
+	SECTION("The one and a half policy grows the capacity by half") {
+		dsa::Vector<Value, Allocator, dsa::One_And_A_Half_Growth_Policy> vector{1, 2};
+
+		vector.append(3);
+		REQUIRE(vector.capacity() == 3ULL);
+
+		vector.append(4);
+		REQUIRE(vector.capacity() == 4ULL);
+
+		vector.append(5);
+		REQUIRE(vector.capacity() == 6ULL);
+		REQUIRE_THAT(vector, EqualsRange({1, 2, 3, 4, 5}));
+	}
+}
+
 TEST_CASE("Vectors can be shrunk to free unused memory", "[vector]") {
 	Handler_Scope scope;
 
@@ -0,0 +1,76 @@
+#include <dsa/work_stealing_pool.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+
+namespace test
+{
+
+namespace
+{
+
+std::size_t parallel_fibonacci(dsa::Work_Stealing_Pool &pool, std::size_t n) {
+	if (n < 2)
+	{
+		return n;
+	}
+
+	std::size_t first  = 0;
+	std::size_t second = 0;
+	pool.invoke(
+	    [&] { first = parallel_fibonacci(pool, n - 1); },
+	    [&] { second = parallel_fibonacci(pool, n - 2); });
+	return first + second;
+}
+
+} // namespace
+
+TEST_CASE("Work stealing pools run submitted tasks", "[work_stealing_pool]") {
+	std::atomic<std::size_t> count = 0;
+	{
+		dsa::Work_Stealing_Pool pool(4);
+		REQUIRE(pool.thread_count() == 4);
+
+		for (std::size_t i = 0; i < 100; ++i)
+		{
+			pool.submit([&] { count++; });
+		}
+	}
+
+	REQUIRE(count == 100);
+}
+
+TEST_CASE("Work stealing pools run nested fork join tasks", "[work_stealing_pool]") {
+	std::size_t const thread_count = GENERATE(0ULL, 1ULL, 4ULL);
+
+	dsa::Work_Stealing_Pool pool(thread_count);
+
+	REQUIRE(parallel_fibonacci(pool, 20) == 6'765);
+}
+
+TEST_CASE("Work stealing pools keep deeply nested fork join tasks on a bounded stack", "[work_stealing_pool]") {
+	std::size_t const thread_count = GENERATE(0ULL, 1ULL, 4ULL);
+
+	dsa::Work_Stealing_Pool pool(thread_count);
+
+	REQUIRE(parallel_fibonacci(pool, 27) == 196'418);
+}
+
+TEST_CASE("Work stealing pools rethrow exceptions from invoked functions", "[work_stealing_pool]") {
+	dsa::Work_Stealing_Pool pool(2);
+
+	bool finished = false;
+	REQUIRE_THROWS_AS(
+	    pool.invoke([] { throw std::runtime_error("first"); }, [&] { finished = true; }),
+	    std::runtime_error);
+	REQUIRE(finished);
+
+	REQUIRE_THROWS_AS(
+	    pool.invoke([] {}, [] { throw std::runtime_error("second"); }),
+	    std::runtime_error);
+}
+
+} // namespace test